@@ -0,0 +1,182 @@
+#include <control/control.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <span>
+#include <string_view>
+#include <vector>
+#include <ventilation/ventilation.hpp>
+
+template <typename T>
+inline void
+escape(T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile void* sink;
+    sink = &value;
+#endif
+}
+
+template <typename Precision> constexpr std::string_view precision = "unknown";
+template <> constexpr std::string_view precision<float>         = "f32";
+template <> constexpr std::string_view precision<double>        = "f64";
+
+template <typename Target> constexpr std::string_view airway = "unknown";
+template <> constexpr std::string_view airway<ventilation::Flow<float>>         = "flow";
+template <> constexpr std::string_view airway<ventilation::Flow<double>>        = "flow";
+template <> constexpr std::string_view airway<ventilation::Pressure<float>>     = "pressure";
+template <> constexpr std::string_view airway<ventilation::Pressure<double>>    = "pressure";
+template <> constexpr std::string_view airway<ventilation::Volume<float>>       = "volume";
+template <> constexpr std::string_view airway<ventilation::Volume<double>>      = "volume";
+
+constexpr std::size_t REPETITIONS = 7;
+
+template <typename F>
+double
+measure(std::size_t steps, F&& f) {
+    using clock = std::chrono::steady_clock;
+    double best = 0.0;
+    for (std::size_t r = 0; r < REPETITIONS; r++) {
+        auto start  = clock::now();
+        f();
+        auto end    = clock::now();
+        double ns   = std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(steps);
+        best        = (r == 0) ? ns : std::min(best, ns);
+    }
+    return best;
+}
+
+template <typename Target>
+void
+report(std::string_view term, std::string_view mode, std::size_t steps, double ns) {
+    using Precision = typename ventilation::precision<Target>::type;
+    std::cout   << term
+                << ',' << precision<Precision>
+                << ',' << airway<Target>
+                << ',' << mode
+                << ',' << steps
+                << ',' << ns
+                << '\n';
+}
+
+template <typename Target, typename Term>
+void
+single(std::string_view name, Term term, std::span<const control::Process<Target>> samples) {
+    using Precision = typename ventilation::precision<Target>::type;
+    double ns = measure(samples.size(), [&] {
+        for (const control::Process<Target>& sample : samples) {
+            control::Value<Precision> value = term(sample);
+            escape(value);
+        }
+    });
+    report<Target>(name, "single", samples.size(), ns);
+}
+
+template <typename Target, typename Term>
+void
+batched(std::string_view name, Term term, std::span<const control::Process<Target>> samples) {
+    using Precision = typename ventilation::precision<Target>::type;
+    std::vector<control::Value<Precision>> output(samples.size());
+    double ns = measure(samples.size(), [&] {
+        term(samples, std::span(output));
+        escape(output);
+    });
+    report<Target>(name, "batched", samples.size(), ns);
+}
+
+template <typename Target>
+void
+visited(std::span<const control::Process<Target>> samples, const Target& target) {
+    using Precision = typename ventilation::precision<Target>::type;
+    using Gain      = control::Gain<Target>;
+
+    std::vector<control::Control<Target>> controller = {
+          control::Proportional<Target>(Gain(Precision(0.5)), target)
+        , control::Integral<Target>(Gain(Precision(5.0e1)), target)
+        , control::Differential<Target>(Gain(Precision(3e-4)), target)
+    };
+    double ns = measure(samples.size(), [&] {
+        for (const control::Process<Target>& sample : samples) {
+            Target output{};
+            control::Action<Target> action{sample};
+            for (control::Control<Target>& c : controller) {
+                output += std::visit(action, c);
+            }
+            escape(output);
+        }
+    });
+    report<Target>("terms", "visit", samples.size(), ns);
+
+    control::Proportional<Target>   proportional(Gain(Precision(0.5)), target);
+    control::Integral<Target>       integral(Gain(Precision(5.0e1)), target);
+    control::Differential<Target>   differential(Gain(Precision(3e-4)), target);
+    ns = measure(samples.size(), [&] {
+        for (const control::Process<Target>& sample : samples) {
+            Target output{};
+            output += proportional(sample);
+            output += integral(sample);
+            output += differential(sample);
+            escape(output);
+        }
+    });
+    report<Target>("terms", "direct", samples.size(), ns);
+}
+
+template <typename Target>
+void
+run(std::size_t steps) {
+    using Precision = typename ventilation::precision<Target>::type;
+    using Gain      = control::Gain<Target>;
+
+    const Target target = Target(Precision(1.0));
+    const control::Time<Precision> period(Precision(1e-3));
+    std::vector<control::Process<Target>> samples;
+    samples.reserve(steps);
+    for (std::size_t i = 0; i < steps; i++) {
+        Precision measurement = static_cast<Precision>(i % 100) / Precision(100);
+        samples.push_back({Target(measurement), period});
+    }
+
+    const Gain kp(Precision(0.5));
+    const Gain ki(Precision(5.0e1));
+    const Gain kd(Precision(3e-4));
+
+    single<Target>("proportional", control::Proportional<Target>(kp, target), samples);
+    single<Target>("integral", control::Integral<Target>(ki, target), samples);
+    single<Target>("differential", control::Differential<Target>(kd, target), samples);
+    single<Target>("pid", control::PID<Target>(kp, ki, kd, target), samples);
+    single<Target>("periodic-pid", control::PeriodicPID<Target>(kp, ki, kd, target, period), samples);
+    single<Target>("incremental", control::Incremental<Target>(kp, ki, kd, target, period), samples);
+    single<Target>("filtered-differential"
+        , control::FilteredDifferential<Target>(kd, target, control::Time<Precision>(Precision(4e-3)), period)
+        , samples);
+
+    batched<Target>("proportional", control::Proportional<Target>(kp, target), samples);
+    batched<Target>("integral", control::Integral<Target>(ki, target), samples);
+    batched<Target>("differential", control::Differential<Target>(kd, target), samples);
+    batched<Target>("pid", control::PID<Target>(kp, ki, kd, target), samples);
+
+    visited<Target>(samples, target);
+}
+
+int
+main(int argc, char** argv) {
+    std::size_t steps = (argc > 1) ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : 100000;
+    if (steps == 0) {
+        std::cerr << "usage: " << argv[0] << " [steps]" << std::endl;
+        return 1;
+    }
+
+    std::cout << "term,precision,airway,mode,steps,ns_per_step\n";
+    run<ventilation::Flow<float>>(steps);
+    run<ventilation::Pressure<float>>(steps);
+    run<ventilation::Volume<float>>(steps);
+    run<ventilation::Flow<double>>(steps);
+    run<ventilation::Pressure<double>>(steps);
+    run<ventilation::Volume<double>>(steps);
+    std::cout.flush();
+    return 0;
+}
@@ -0,0 +1,38 @@
+#include <control/control.hpp>
+#include <cstddef>
+#include <cstdint>
+#ifndef CONTROL_FREESTANDING
+#include <cstdio>
+#endif
+#include <ventilation/ventilation.hpp>
+
+using Pressure  = ventilation::Pressure<float>;
+using Process   = control::Process<Pressure>;
+using Gain      = control::Gain<Pressure>;
+using Time      = control::Time<float>;
+
+constexpr std::size_t STEPS = 1000;
+
+volatile float sensor;
+volatile float actuator;
+volatile std::uint64_t startup;
+
+int
+main(int, char**) {
+    const std::uint64_t entry = control::cycles();
+    control::PID<Pressure> controller(Gain(0.5f), Gain(5.0e1f), Gain(3e-4f), Pressure(1.0f));
+
+    Process process{Pressure(sensor), Time(1e-3f)};
+    actuator    = static_cast<float>(controller(process));
+    startup     = control::cycles() - entry;
+
+    for (std::size_t i = 1; i < STEPS; i++) {
+        process.measurement = Pressure(sensor);
+        actuator            = static_cast<float>(controller(process));
+    }
+
+#ifndef CONTROL_FREESTANDING
+    std::printf("startup,%llu\n", static_cast<unsigned long long>(startup));
+#endif
+    return 0;
+}
@@ -9,32 +9,29 @@ using Time      = control::Time<float>;
 
 const Pressure TARGET   = Pressure(1.0f);
 const Time DURATION     = Time(1e-3f);
+const Time BREATH       = Time(2e-1f);
+const Time LAG          = Time(1e-2f);
+const float VALVE       = 2.0f;
 
 int
 main(int, char**) {
-    using Gain = control::Gain<Pressure>;
+    using Gain      = control::Gain<Pressure>;
+    using Mechanics = control::Mechanics<float>;
 
-    std::vector<control::Control<Pressure>> controller = {
-          control::Proportional<Pressure>(Gain(0.5f), TARGET)
-        , control::Integral<Pressure>(Gain(5.0e1f), TARGET)
-        , control::Differential<Pressure>(Gain(3e-4f), TARGET)
-    };
+    control::PID<Pressure> controller(Gain(0.5f), Gain(5.0e1f), Gain(3e-4f), TARGET);
+    auto trajectory = control::Trajectory<Pressure>::square(Pressure(0.0f), TARGET, BREATH, DURATION, 0.5f);
+
+    control::Plant<float> plant(
+        control::Valve<float>(LAG, VALVE)
+        , control::Compartment<float>(Mechanics{10.0f, 5.0e-2f}, Pressure(0.0f))
+        , control::Leak<float>(0.0f)
+        );
 
     Process process{Pressure(0.0f), DURATION};
-    for (std::size_t i = 0; i < 10; i++) {
-        std::cout   << Pressure(0.0f) 
-                    << ", "
-                    << Pressure(0.0f)
-                    << std::endl;
-    }
-    for (std::size_t i = 0; i < 100; i++) {
-        Pressure p = process.measurement;
-        control::Action<Pressure> action{process};
-        for (control::Control<Pressure>& c : controller) {
-            p += std::visit(action, c);
-        }
-        process.measurement = p;
-        std::cout   << TARGET 
+    for (std::size_t i = 0; i < 2 * trajectory.size(); i++) {
+        const Pressure& target = trajectory();
+        process.measurement = plant(Pressure(controller(process, target)), DURATION).pressure;
+        std::cout   << target
                     << ", "
                     << process.measurement
                     << std::endl;
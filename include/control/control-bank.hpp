@@ -0,0 +1,137 @@
+#ifndef CONTROL_BANK_HPP__
+#define CONTROL_BANK_HPP__
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <ventilation/ventilation.hpp>
+
+#include "control-gain.hpp"
+#include "control-time.hpp"
+#include "control-value.hpp"
+
+namespace control {
+    namespace detail {
+        inline constexpr std::size_t alignment = 64;
+
+        template <typename Precision, std::size_t N>
+        struct lanes {
+            static_assert(N != std::dynamic_extent);
+            using type = std::array<Precision, N>;
+        };
+
+        template <typename Precision>
+        inline void
+        step(std::size_t n
+            , Precision dt
+            , const Precision* __restrict proportional
+            , const Precision* __restrict integral
+            , const Precision* __restrict differential
+            , const Precision* __restrict target
+            , const Precision* __restrict measurement
+            , Precision* __restrict accumulator
+            , Precision* __restrict previous
+            , Precision* __restrict output) {
+            const Precision inv = Precision(1) / dt;
+            for (std::size_t i = 0; i < n; i++) {
+                Precision error = target[i] - measurement[i];
+                accumulator[i] += error * dt;
+                Precision diff  = (error - previous[i]) * inv;
+                previous[i]     = error;
+
+                output[i] = proportional[i] * error
+                          + integral[i] * accumulator[i]
+                          + differential[i] * diff;
+            }
+        }
+    } // namespace detail
+
+    template <typename Target, std::size_t N = std::dynamic_extent>
+    class Bank {
+        static_assert(ventilation::is_airway_type<Target>::value);
+        using Precision = typename ventilation::precision<Target>::type;
+        using Lanes     = typename detail::lanes<Precision, N>::type;
+        public:
+            Bank() requires (N != std::dynamic_extent)
+                : proportional_{}
+                , integral_{}
+                , differential_{}
+                , target_{}
+                , accumulator_{}
+                , previous_{}
+                , measurement_{}
+                , output_{}
+            {}
+
+            explicit Bank(std::size_t channels) requires (N == std::dynamic_extent)
+                : proportional_(channels)
+                , integral_(channels)
+                , differential_(channels)
+                , target_(channels)
+                , accumulator_(channels)
+                , previous_(channels)
+                , measurement_(channels)
+                , output_(channels)
+            {}
+
+            std::size_t
+            size() const noexcept {
+                return target_.size();
+            }
+
+            void
+            assign(std::size_t channel
+                , const Gain<Target>& proportional
+                , const Gain<Target>& integral
+                , const Gain<Target>& differential
+                , const Target& target) {
+                proportional_[channel]  = static_cast<Precision>(proportional);
+                integral_[channel]      = static_cast<Precision>(integral);
+                differential_[channel]  = static_cast<Precision>(differential);
+                target_[channel]        = static_cast<Precision>(target);
+                accumulator_[channel]   = Precision();
+                previous_[channel]      = Precision();
+            }
+
+            void
+            operator()(std::span<const Target, N> measurements
+                , const control::Time<Precision>& duration
+                , std::span<control::Value<Precision>, N> output) {
+                const std::size_t n = size();
+                assert(measurements.size() >= n);
+                assert(output.size() >= n);
+                for (std::size_t i = 0; i < n; i++) {
+                    measurement_[i] = static_cast<Precision>(measurements[i]);
+                }
+
+                detail::step(n
+                    , static_cast<Precision>(duration.count())
+                    , std::assume_aligned<detail::alignment>(proportional_.data())
+                    , std::assume_aligned<detail::alignment>(integral_.data())
+                    , std::assume_aligned<detail::alignment>(differential_.data())
+                    , std::assume_aligned<detail::alignment>(target_.data())
+                    , std::assume_aligned<detail::alignment>(measurement_.data())
+                    , std::assume_aligned<detail::alignment>(accumulator_.data())
+                    , std::assume_aligned<detail::alignment>(previous_.data())
+                    , std::assume_aligned<detail::alignment>(output_.data())
+                    );
+
+                for (std::size_t i = 0; i < n; i++) {
+                    output[i] = control::Value<Precision>(Target(output_[i]));
+                }
+            }
+        private:
+            alignas(detail::alignment) Lanes proportional_;
+            alignas(detail::alignment) Lanes integral_;
+            alignas(detail::alignment) Lanes differential_;
+            alignas(detail::alignment) Lanes target_;
+            alignas(detail::alignment) Lanes accumulator_;
+            alignas(detail::alignment) Lanes previous_;
+            alignas(detail::alignment) Lanes measurement_;
+            alignas(detail::alignment) Lanes output_;
+    };
+} // namespace control
+
+#endif // CONTROL_BANK_HPP__
@@ -0,0 +1,87 @@
+#ifndef CONTROL_CASCADE_HPP__
+#define CONTROL_CASCADE_HPP__
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <ventilation/ventilation.hpp>
+
+#include "control-pipeline.hpp"
+#include "control-process.hpp"
+#include "control-time.hpp"
+#include "control-value.hpp"
+
+namespace control {
+    template <typename Outer
+        , typename Inner
+        , Term<Outer> OuterController
+        , Term<Inner> InnerController>
+        requires requires(InnerController& inner, const control::Process<Inner>& current, const Inner& target) {
+            inner(current, target);
+        }
+    class Cascade {
+        static_assert(ventilation::is_airway_type<Outer>::value);
+        static_assert(ventilation::is_airway_type<Inner>::value);
+        static_assert(std::is_same<
+            typename ventilation::precision<Outer>::type,
+            typename ventilation::precision<Inner>::type
+            >::value);
+        using Precision = typename ventilation::precision<Inner>::type;
+        public:
+            constexpr Cascade(const OuterController& outer
+                , const InnerController& inner
+                , std::size_t ratio
+                , const Inner& target)
+                : outer_(outer)
+                , inner_(inner)
+                , ratio_(ratio)
+                , countdown_(0)
+                , elapsed_(Precision())
+                , target_(target)
+            {
+                assert(ratio_ > 0);
+            }
+
+            constexpr control::Value<Precision>
+            operator()(const Outer& measurement, const control::Process<Inner>& current) {
+                elapsed_ += current.duration;
+                if (countdown_ == 0) {
+                    target_     = static_cast<Inner>(outer_(control::Process<Outer>{measurement, elapsed_}));
+                    countdown_  = ratio_;
+                    elapsed_    = control::Time<Precision>(Precision());
+                }
+                countdown_--;
+
+                return inner_(current, target_);
+            }
+
+            constexpr const Inner&
+            target() const noexcept {
+                return target_;
+            }
+
+            constexpr std::size_t
+            ratio() const noexcept {
+                return ratio_;
+            }
+
+            constexpr OuterController&
+            outer() noexcept {
+                return outer_;
+            }
+
+            constexpr InnerController&
+            inner() noexcept {
+                return inner_;
+            }
+        private:
+            OuterController             outer_;
+            InnerController             inner_;
+            std::size_t                 ratio_;
+            std::size_t                 countdown_;
+            control::Time<Precision>    elapsed_;
+            Inner                       target_;
+    };
+} // namespace control
+
+#endif // CONTROL_CASCADE_HPP__
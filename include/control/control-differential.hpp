@@ -1,11 +1,13 @@
 #ifndef CONTROL_DIFFERENTIAL_HPP__
 #define CONTROL_DIFFERENTIAL_HPP__
 
-#include <iostream>
-#include <ostream>
+#include <cassert>
+#include <cstddef>
+#include <span>
 #include <ventilation/ventilation.hpp>
 
 #include "control-gain.hpp"
+#include "control-parameters.hpp"
 #include "control-process.hpp"
 #include "control-value.hpp"
 
@@ -15,19 +17,53 @@ namespace control {
         static_assert(ventilation::is_airway_type<Target>::value);
         using Precision = typename ventilation::precision<Target>::type;
         public:
-            Differential(const Gain<Target>& gain, const Target& target)
+            constexpr Differential(const Gain<Target>& gain, const Target& target)
                 : gain_(gain)
                 , target_(target)
                 , previous_(Target())
             {}
 
-            control::Value<Precision>
+            constexpr control::Value<Precision>
             operator()(const control::Process<Target>& current) {
-                Target error        = current.error(target_);
-                Target differential = (error - previous_) * (1.0 / current.count());
-                previous_           = error;
+                Target error    = current.error(target_);
+                Target change   = gain_ * (error - previous_);
+                previous_       = error;
 
-                return control::Value<Precision>(gain_ * differential);
+                return control::Value<Precision>(Target(static_cast<Precision>(change) / current.count()));
+            }
+
+            constexpr control::Value<Precision>
+            operator()(const control::Process<Target>& current, const Target& target) {
+                target_ = target;
+                return (*this)(current);
+            }
+
+            constexpr void
+            retune(const Gain<Target>& gain, const Target& target) noexcept {
+                previous_   = previous_ + (target - target_);
+                gain_       = gain;
+                target_     = target;
+            }
+
+            constexpr void
+            retune(const Parameters<Target>& parameters) noexcept {
+                retune(parameters.differential, parameters.target);
+            }
+
+            constexpr void
+            operator()(std::span<const control::Process<Target>> current
+                , std::span<control::Value<Precision>> output) {
+                assert(output.size() >= current.size());
+                const Gain<Target> gain     = gain_;
+                const Target target         = target_;
+                Target previous             = previous_;
+                for (std::size_t i = 0; i < current.size(); i++) {
+                    Target error    = current[i].error(target);
+                    Target change   = gain * (error - previous);
+                    previous        = error;
+                    output[i]       = control::Value<Precision>(Target(static_cast<Precision>(change) / current[i].count()));
+                }
+                previous_ = previous;
             }
         private:
             Gain<Target>    gain_;
@@ -0,0 +1,78 @@
+#ifndef CONTROL_FILTERED_HPP__
+#define CONTROL_FILTERED_HPP__
+
+#include <ventilation/ventilation.hpp>
+
+#include "control-gain.hpp"
+#include "control-process.hpp"
+#include "control-time.hpp"
+#include "control-value.hpp"
+
+namespace control {
+    template <typename Target>
+    class FilteredDifferential {
+        static_assert(ventilation::is_airway_type<Target>::value);
+        using Precision = typename ventilation::precision<Target>::type;
+        public:
+            constexpr FilteredDifferential(const Gain<Target>& gain
+                , const Target& target
+                , const control::Time<Precision>& filter)
+                : gain_(static_cast<Precision>(gain))
+                , filter_(static_cast<Precision>(filter.count()))
+                , period_(control::Time<Precision>::zero())
+                , decay_()
+                , scale_()
+                , target_(target)
+                , previous_(Target{})
+                , output_(Target{})
+            {}
+
+            constexpr FilteredDifferential(const Gain<Target>& gain
+                , const Target& target
+                , const control::Time<Precision>& filter
+                , const control::Time<Precision>& period)
+                : FilteredDifferential(gain, target, filter)
+            {
+                rate(period);
+            }
+
+            constexpr control::Value<Precision>
+            operator()(const control::Process<Target>& current) {
+                if (current.duration != period_) {
+                    rate(current.duration);
+                }
+
+                Target error    = current.error(target_);
+                output_         = decay_ * output_ + scale_ * (error - previous_);
+                previous_       = error;
+
+                return control::Value<Precision>(output_);
+            }
+
+            constexpr control::Value<Precision>
+            operator()(const control::Process<Target>& current, const Target& target) {
+                target_ = target;
+                return (*this)(current);
+            }
+        private:
+            constexpr void
+            rate(const control::Time<Precision>& period) {
+                Precision denominator = filter_ + static_cast<Precision>(period.count());
+
+                period_ = period;
+                decay_  = Gain<Target>(filter_ / denominator);
+                scale_  = Gain<Target>(gain_ / denominator);
+            }
+
+            Precision                   gain_;
+            Precision                   filter_;
+            control::Time<Precision>    period_;
+            Gain<Target>                decay_;
+            Gain<Target>                scale_;
+            Target                      target_;
+            Target                      previous_;
+            Target                      output_;
+    };
+} // namespace control
+
+#endif // CONTROL_FILTERED_HPP__
@@ -0,0 +1,166 @@
+#ifndef CONTROL_FIXED_HPP__
+#define CONTROL_FIXED_HPP__
+
+#include <chrono>
+#include <compare>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace control {
+    template <typename Storage, int Fraction>
+    class Fixed {
+        static_assert(std::is_integral<Storage>::value && std::is_signed<Storage>::value);
+        static_assert(sizeof(Storage) <= sizeof(std::int32_t));
+        static_assert(Fraction > 0 && Fraction < std::numeric_limits<Storage>::digits + 1);
+        using Wide = std::conditional_t<(sizeof(Storage) < sizeof(std::int32_t)), std::int32_t, std::int64_t>;
+
+        static constexpr Wide one       = Wide(1) << Fraction;
+        static constexpr Wide highest   = std::numeric_limits<Storage>::max();
+        static constexpr Wide lowest    = std::numeric_limits<Storage>::min();
+
+        static constexpr Storage
+        saturate(Wide value) noexcept {
+            return static_cast<Storage>(value < lowest ? lowest : (value > highest ? highest : value));
+        }
+
+        template <typename T>
+        static constexpr Storage
+        convert(T value) noexcept {
+            if constexpr (std::is_floating_point<T>::value) {
+                T scaled = value * static_cast<T>(one);
+                if (scaled != scaled) {
+                    return 0;
+                }
+                if (scaled >= static_cast<T>(highest)) {
+                    return static_cast<Storage>(highest);
+                }
+                if (scaled <= static_cast<T>(lowest)) {
+                    return static_cast<Storage>(lowest);
+                }
+                return saturate(static_cast<Wide>(scaled + (scaled < T(0) ? T(-0.5) : T(0.5))));
+            } else {
+                if (std::cmp_greater(value, highest >> Fraction)) {
+                    return static_cast<Storage>(highest);
+                }
+                if (std::cmp_less(value, lowest >> Fraction)) {
+                    return static_cast<Storage>(lowest);
+                }
+                return saturate(static_cast<Wide>(value) * one);
+            }
+        }
+        public:
+            constexpr Fixed() noexcept : raw_(0) {}
+
+            template <typename T>
+                requires std::is_floating_point<T>::value
+            constexpr Fixed(T value) noexcept : raw_(convert(value)) {}
+
+            template <typename T>
+                requires std::is_integral<T>::value
+            constexpr Fixed(T value) noexcept : raw_(convert(value)) {}
+
+            static constexpr Fixed
+            raw(Storage value) noexcept {
+                Fixed f;
+                f.raw_ = value;
+                return f;
+            }
+
+            constexpr Storage
+            raw() const noexcept {
+                return raw_;
+            }
+
+            template <typename T>
+                requires std::is_floating_point<T>::value
+            explicit constexpr operator T() const noexcept {
+                return static_cast<T>(raw_) / static_cast<T>(one);
+            }
+
+            friend constexpr Fixed
+            operator+(const Fixed& lhs, const Fixed& rhs) noexcept {
+                return raw(saturate(Wide(lhs.raw_) + Wide(rhs.raw_)));
+            }
+
+            friend constexpr Fixed
+            operator-(const Fixed& lhs, const Fixed& rhs) noexcept {
+                return raw(saturate(Wide(lhs.raw_) - Wide(rhs.raw_)));
+            }
+
+            friend constexpr Fixed
+            operator*(const Fixed& lhs, const Fixed& rhs) noexcept {
+                Wide product = Wide(lhs.raw_) * Wide(rhs.raw_);
+                return raw(saturate((product + (one >> 1)) >> Fraction));
+            }
+
+            friend constexpr Fixed
+            operator/(const Fixed& lhs, const Fixed& rhs) noexcept {
+                if (rhs.raw_ == 0) {
+                    return raw(static_cast<Storage>(lhs.raw_ < 0 ? lowest : highest));
+                }
+                return raw(saturate((Wide(lhs.raw_) * one) / Wide(rhs.raw_)));
+            }
+
+            constexpr Fixed
+            operator-() const noexcept {
+                return raw(saturate(-Wide(raw_)));
+            }
+
+            constexpr Fixed
+            operator+() const noexcept {
+                return *this;
+            }
+
+            constexpr Fixed& operator+=(const Fixed& rhs) noexcept { return *this = *this + rhs; }
+            constexpr Fixed& operator-=(const Fixed& rhs) noexcept { return *this = *this - rhs; }
+            constexpr Fixed& operator*=(const Fixed& rhs) noexcept { return *this = *this * rhs; }
+            constexpr Fixed& operator/=(const Fixed& rhs) noexcept { return *this = *this / rhs; }
+
+            friend constexpr bool
+            operator==(const Fixed& lhs, const Fixed& rhs) noexcept = default;
+
+            friend constexpr std::strong_ordering
+            operator<=>(const Fixed& lhs, const Fixed& rhs) noexcept = default;
+        private:
+            Storage raw_;
+    };
+
+    using Q15 = Fixed<std::int16_t, 15>;
+    using Q31 = Fixed<std::int32_t, 31>;
+
+    template <typename T>
+    struct is_fixed : std::false_type {};
+
+    template <typename Storage, int Fraction>
+    struct is_fixed<Fixed<Storage, Fraction>> : std::true_type {};
+
+    template <typename T>
+    struct is_precision
+        : std::bool_constant<std::is_floating_point<T>::value || is_fixed<T>::value> {};
+} // namespace control
+
+template <typename Storage, int Fraction>
+struct std::numeric_limits<control::Fixed<Storage, Fraction>> {
+    using type = control::Fixed<Storage, Fraction>;
+
+    static constexpr bool is_specialized    = true;
+    static constexpr bool is_signed         = true;
+    static constexpr bool is_integer        = false;
+    static constexpr bool is_exact          = true;
+    static constexpr bool has_infinity      = false;
+    static constexpr bool has_quiet_NaN     = false;
+    static constexpr bool is_bounded        = true;
+    static constexpr int digits             = std::numeric_limits<Storage>::digits;
+
+    static constexpr type min() noexcept { return type::raw(1); }
+    static constexpr type max() noexcept { return type::raw(std::numeric_limits<Storage>::max()); }
+    static constexpr type lowest() noexcept { return type::raw(std::numeric_limits<Storage>::min()); }
+    static constexpr type epsilon() noexcept { return type::raw(1); }
+};
+
+template <typename Storage, int Fraction>
+struct std::chrono::treat_as_floating_point<control::Fixed<Storage, Fraction>> : std::true_type {};
+
+#endif // CONTROL_FIXED_HPP__
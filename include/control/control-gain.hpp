@@ -1,7 +1,6 @@
 #ifndef CONTROL_GAIN_HPP__
 #define CONTROL_GAIN_HPP__
 
-#include <ostream>
 #include <ventilation/ventilation.hpp>
 
 namespace control {
@@ -10,21 +9,19 @@ namespace control {
         static_assert(ventilation::is_airway_type<T>::value);
         using Precision = typename ventilation::precision<T>::type;
         public:
-            explicit Gain() : value_(Precision()) {}
-            explicit Gain(Precision value) : value_(value) {}
+            explicit constexpr Gain() : value_(Precision()) {}
+            explicit constexpr Gain(Precision value) : value_(value) {}
 
-            friend std::ostream&
-            operator<<(std::ostream& os, const Gain& p) {
-                os << p.value_;
-                return os;
+            explicit constexpr operator Precision() const noexcept {
+                return static_cast<Precision>(value_);
             }
 
-            friend T
+            friend constexpr T
             operator*(const Gain<T>& lhs, const T& rhs) {
                 return lhs.value_ * rhs;
             }
 
-            friend T
+            friend constexpr T
             operator*(const T& lhs, const Gain<T>& rhs) {
                 return lhs * rhs.value_;
             }
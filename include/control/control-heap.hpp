@@ -0,0 +1,46 @@
+#ifndef CONTROL_HEAP_HPP__
+#define CONTROL_HEAP_HPP__
+
+#include <cstddef>
+#include <new>
+#include <span>
+#include <vector>
+
+#include "control-bank.hpp"
+
+namespace control {
+    namespace detail {
+        template <typename T>
+        struct Aligned {
+            using value_type = T;
+
+            Aligned() noexcept = default;
+            template <typename U> Aligned(const Aligned<U>&) noexcept {}
+
+            T*
+            allocate(std::size_t n) {
+                return static_cast<T*>(
+                    ::operator new(n * sizeof(T), std::align_val_t(alignment))
+                    );
+            }
+
+            void
+            deallocate(T* p, std::size_t) noexcept {
+                ::operator delete(p, std::align_val_t(alignment));
+            }
+
+            template <typename U>
+            bool
+            operator==(const Aligned<U>&) const noexcept {
+                return true;
+            }
+        };
+
+        template <typename Precision>
+        struct lanes<Precision, std::dynamic_extent> {
+            using type = std::vector<Precision, Aligned<Precision>>;
+        };
+    } // namespace detail
+} // namespace control
+
+#endif // CONTROL_HEAP_HPP__
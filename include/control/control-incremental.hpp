@@ -0,0 +1,59 @@
+#ifndef CONTROL_INCREMENTAL_HPP__
+#define CONTROL_INCREMENTAL_HPP__
+
+#include <ventilation/ventilation.hpp>
+
+#include "control-gain.hpp"
+#include "control-process.hpp"
+#include "control-time.hpp"
+#include "control-value.hpp"
+
+namespace control {
+    template <typename Target>
+    class Incremental {
+        static_assert(ventilation::is_airway_type<Target>::value);
+        using Precision = typename ventilation::precision<Target>::type;
+        public:
+            constexpr Incremental(const Gain<Target>& proportional
+                , const Gain<Target>& integral
+                , const Gain<Target>& differential
+                , const Target& target
+                , const control::Time<Precision>& period)
+                : q0_(static_cast<Precision>(proportional)
+                    + static_cast<Precision>(integral) * static_cast<Precision>(period.count())
+                    + static_cast<Precision>(differential) / static_cast<Precision>(period.count()))
+                , q1_(Precision()
+                    - static_cast<Precision>(proportional)
+                    - Precision(2) * static_cast<Precision>(differential) / static_cast<Precision>(period.count()))
+                , q2_(static_cast<Precision>(differential) / static_cast<Precision>(period.count()))
+                , target_(target)
+                , previous_(Target{})
+                , before_(Target{})
+            {}
+
+            constexpr control::Value<Precision>
+            operator()(const control::Process<Target>& current) {
+                Target error    = current.error(target_);
+                Target delta    = q0_ * error + q1_ * previous_ + q2_ * before_;
+                before_         = previous_;
+                previous_       = error;
+
+                return control::Value<Precision>(delta);
+            }
+
+            constexpr control::Value<Precision>
+            operator()(const control::Process<Target>& current, const Target& target) {
+                target_ = target;
+                return (*this)(current);
+            }
+        private:
+            Gain<Target>    q0_;
+            Gain<Target>    q1_;
+            Gain<Target>    q2_;
+            Target          target_;
+            Target          previous_;
+            Target          before_;
+    };
+} // namespace control
+
+#endif // CONTROL_INCREMENTAL_HPP__
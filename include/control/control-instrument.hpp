@@ -0,0 +1,155 @@
+#ifndef CONTROL_INSTRUMENT_HPP__
+#define CONTROL_INSTRUMENT_HPP__
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#if defined(CONTROL_INSTRUMENTATION) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#endif
+
+namespace control {
+#if defined(CONTROL_INSTRUMENTATION)
+    inline constexpr bool instrumented = true;
+#else
+    inline constexpr bool instrumented = false;
+#endif
+
+    inline constexpr std::size_t BUCKETS = 32;
+
+    inline std::uint64_t
+    cycles() noexcept {
+#if defined(CONTROL_INSTRUMENTATION) && (defined(__x86_64__) || defined(__i386__))
+        return __rdtsc();
+#elif defined(CONTROL_INSTRUMENTATION) && defined(__aarch64__)
+        std::uint64_t value;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+        return value;
+#else
+        return static_cast<std::uint64_t>(
+            std::chrono::steady_clock::now().time_since_epoch().count()
+            );
+#endif
+    }
+
+    struct Snapshot {
+        std::uint64_t                           calls;
+        std::uint64_t                           worst;
+        std::array<std::uint64_t, BUCKETS>      histogram;
+    };
+
+    class Statistics {
+        public:
+            Statistics() noexcept
+                : calls_(0)
+                , worst_(0)
+                , histogram_{}
+            {}
+
+            Statistics(const Statistics& other) noexcept
+                : Statistics()
+            {
+                Snapshot s = other.snapshot();
+                calls_.store(s.calls, std::memory_order_relaxed);
+                worst_.store(s.worst, std::memory_order_relaxed);
+                for (std::size_t i = 0; i < BUCKETS; i++) {
+                    histogram_[i].store(s.histogram[i], std::memory_order_relaxed);
+                }
+            }
+
+            Statistics& operator=(const Statistics&) = delete;
+
+            void
+            record(std::uint64_t latency) noexcept {
+                std::size_t bucket = std::bit_width(latency);
+                bucket = bucket < BUCKETS ? bucket : BUCKETS - 1;
+
+                bump(calls_);
+                bump(histogram_[bucket]);
+                if (latency > worst_.load(std::memory_order_relaxed)) {
+                    worst_.store(latency, std::memory_order_relaxed);
+                }
+            }
+
+            Snapshot
+            snapshot() const noexcept {
+                Snapshot s{};
+                s.calls = calls_.load(std::memory_order_relaxed);
+                s.worst = worst_.load(std::memory_order_relaxed);
+                for (std::size_t i = 0; i < BUCKETS; i++) {
+                    s.histogram[i] = histogram_[i].load(std::memory_order_relaxed);
+                }
+                return s;
+            }
+        private:
+            static void
+            bump(std::atomic<std::uint64_t>& counter) noexcept {
+                counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+
+            std::atomic<std::uint64_t>                          calls_;
+            std::atomic<std::uint64_t>                          worst_;
+            std::array<std::atomic<std::uint64_t>, BUCKETS>     histogram_;
+    };
+
+    struct Disabled {
+        void record(std::uint64_t) noexcept {}
+        Snapshot snapshot() const noexcept { return Snapshot{}; }
+    };
+
+    using Recorder = std::conditional_t<instrumented, Statistics, Disabled>;
+
+    template <typename F>
+    decltype(auto)
+    measure(Recorder& recorder, F&& f) {
+        if constexpr (instrumented) {
+            struct Scope {
+                Recorder&       recorder;
+                std::uint64_t   start;
+                ~Scope() { recorder.record(cycles() - start); }
+            } scope{recorder, cycles()};
+            return std::forward<F>(f)();
+        } else {
+            (void) recorder;
+            return std::forward<F>(f)();
+        }
+    }
+
+    template <typename Callable>
+    class Instrumented {
+        public:
+            explicit Instrumented(const Callable& callable)
+                : callable_(callable)
+                , recorder_()
+            {}
+
+            template <typename... Args>
+            decltype(auto)
+            operator()(Args&&... args) {
+                return measure(recorder_, [&]() -> decltype(auto) {
+                    return callable_(std::forward<Args>(args)...);
+                });
+            }
+
+            Callable&
+            get() noexcept {
+                return callable_;
+            }
+
+            Snapshot
+            snapshot() const noexcept {
+                return recorder_.snapshot();
+            }
+        private:
+            Callable                            callable_;
+            [[no_unique_address]] Recorder      recorder_;
+    };
+} // namespace control
+
+#endif // CONTROL_INSTRUMENT_HPP__
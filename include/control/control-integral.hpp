@@ -1,11 +1,15 @@
 #ifndef CONTROL_INTEGRAL_HPP__
 #define CONTROL_INTEGRAL_HPP__
 
-#include <ostream>
+#include <cassert>
+#include <cstddef>
+#include <span>
 #include <ventilation/ventilation.hpp>
 
 #include "control-gain.hpp"
+#include "control-parameters.hpp"
 #include "control-process.hpp"
+#include "control-saturation.hpp"
 #include "control-value.hpp"
 
 namespace control {
@@ -14,21 +18,96 @@ namespace control {
         static_assert(ventilation::is_airway_type<Target>::value);
         using Precision = typename ventilation::precision<Target>::type;
         public:
-            Integral(const Gain<Target>& gain, const Target& target)
+            constexpr Integral(const Gain<Target>& gain, const Target& target)
                 : gain_(gain)
                 , target_(target)
+                , limits_()
+                , windup_()
+                , bounded_(false)
                 , accumulator_(Target{})
+                , offset_(Target{})
             {}
 
-            control::Value<Precision>
+            constexpr Integral(const Gain<Target>& gain, const Target& target, const Saturation<Target>& limits)
+                : gain_(gain)
+                , target_(target)
+                , limits_(limits)
+                , windup_(limits / gain)
+                , bounded_(true)
+                , accumulator_(Target{})
+                , offset_(Target{})
+            {}
+
+            constexpr control::Value<Precision>
             operator()(const control::Process<Target>& current) {
                 accumulator_ += current.error(target_) * current.count();
-                return control::Value<Precision>(gain_ * accumulator_);
+                if (bounded_) {
+                    accumulator_ = windup_(accumulator_);
+                }
+                return control::Value<Precision>(gain_ * accumulator_ + offset_);
+            }
+
+            constexpr control::Value<Precision>
+            operator()(const control::Process<Target>& current, const Target& target) {
+                target_ = target;
+                return (*this)(current);
+            }
+
+            constexpr void
+            retune(const Gain<Target>& gain, const Target& target) noexcept {
+                Target held     = offset_ + gain_ * accumulator_;
+                Precision after = static_cast<Precision>(gain);
+                if (after == Precision()) {
+                    offset_         = held;
+                    accumulator_    = Target{};
+                } else {
+                    offset_         = Target{};
+                    accumulator_    = Target(static_cast<Precision>(held) / after);
+                }
+
+                gain_   = gain;
+                target_ = target;
+                if (bounded_) {
+                    windup_         = limits_ / gain;
+                    accumulator_    = windup_(accumulator_);
+                }
+            }
+
+            constexpr void
+            retune(const Parameters<Target>& parameters) noexcept {
+                retune(parameters.integral, parameters.target);
+            }
+
+            constexpr void
+            operator()(std::span<const control::Process<Target>> current
+                , std::span<control::Value<Precision>> output) {
+                assert(output.size() >= current.size());
+                const Gain<Target> gain         = gain_;
+                const Target target             = target_;
+                const Saturation<Target> windup = windup_;
+                const Target offset             = offset_;
+                Target accumulator              = accumulator_;
+                if (bounded_) {
+                    for (std::size_t i = 0; i < current.size(); i++) {
+                        accumulator = windup(accumulator + current[i].error(target) * current[i].count());
+                        output[i]   = control::Value<Precision>(gain * accumulator + offset);
+                    }
+                } else {
+                    for (std::size_t i = 0; i < current.size(); i++) {
+                        accumulator += current[i].error(target) * current[i].count();
+                        output[i]    = control::Value<Precision>(gain * accumulator + offset);
+                    }
+                }
+                accumulator_ = accumulator;
             }
         private:
-            Gain<Target>    gain_;
-            Target          target_;
-            Target          accumulator_;
+            Gain<Target>        gain_;
+            Target              target_;
+            Saturation<Target>  limits_;
+            Saturation<Target>  windup_;
+            bool                bounded_;
+            Target              accumulator_;
+            Target              offset_;
     };
 } // namespace control
 
@@ -0,0 +1,34 @@
+#ifndef CONTROL_IO_HPP__
+#define CONTROL_IO_HPP__
+
+#include <ostream>
+#include <ventilation/ventilation.hpp>
+
+#include "control-fixed.hpp"
+#include "control-gain.hpp"
+#include "control-value.hpp"
+
+namespace control {
+    template <typename Storage, int Fraction>
+    std::ostream&
+    operator<<(std::ostream& os, const Fixed<Storage, Fraction>& f) {
+        os << static_cast<double>(f);
+        return os;
+    }
+
+    template <typename T>
+    std::ostream&
+    operator<<(std::ostream& os, const Gain<T>& p) {
+        os << static_cast<typename ventilation::precision<T>::type>(p);
+        return os;
+    }
+
+    template <typename T>
+    std::ostream&
+    operator<<(std::ostream& os, const Value<T>& v) {
+        os << static_cast<T>(v);
+        return os;
+    }
+} // namespace control
+
+#endif // CONTROL_IO_HPP__
@@ -0,0 +1,148 @@
+#ifndef CONTROL_LOOP_HPP__
+#define CONTROL_LOOP_HPP__
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <ventilation/ventilation.hpp>
+
+#include "control-process.hpp"
+#include "control-ring.hpp"
+#include "control-time.hpp"
+#include "control-value.hpp"
+
+namespace control {
+    struct Timing {
+        std::uint64_t               ticks;
+        std::uint64_t               overruns;
+        std::chrono::nanoseconds    total_jitter;
+        std::chrono::nanoseconds    worst_jitter;
+        std::chrono::nanoseconds    worst_latency;
+    };
+
+    template <typename Target>
+    class Loop {
+        static_assert(ventilation::is_airway_type<Target>::value);
+        using Precision = typename ventilation::precision<Target>::type;
+        using Clock     = std::chrono::nanoseconds;
+        public:
+            explicit Loop(const control::Time<Precision>& period)
+                : period_(std::chrono::duration_cast<Clock>(period))
+                , stopping_(false)
+                , timing_{}
+                , published_()
+                , latest_{}
+            {}
+
+            bool
+            realtime(int priority) noexcept {
+                sched_param parameters{};
+                parameters.sched_priority = priority;
+                return pthread_setschedparam(pthread_self(), SCHED_FIFO, &parameters) == 0;
+            }
+
+            bool
+            pin(int cpu) noexcept {
+#if defined(__linux__)
+                cpu_set_t set;
+                CPU_ZERO(&set);
+                CPU_SET(cpu, &set);
+                return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+                (void) cpu;
+                return false;
+#endif
+            }
+
+            void
+            stop() noexcept {
+                stopping_.store(true, std::memory_order_relaxed);
+            }
+
+            Timing
+            timing() noexcept {
+                published_.poll(latest_);
+                return latest_;
+            }
+
+            template <typename Sense, typename Actuate, typename... Controllers>
+            void
+            run(std::size_t ticks, Sense&& sense, Actuate&& actuate, Controllers&... controllers) {
+                static_assert(sizeof...(Controllers) > 0);
+
+                timing_ = Timing{};
+                published_.publish(timing_);
+
+                Clock deadline  = now();
+                Clock previous  = deadline;
+                for (std::size_t tick = 0; tick < ticks; tick++) {
+                    if (stopping_.load(std::memory_order_relaxed)) {
+                        stopping_.store(false, std::memory_order_relaxed);
+                        break;
+                    }
+
+                    deadline += period_;
+                    sleep(deadline);
+
+                    Clock wake      = now();
+                    Clock jitter    = wake - deadline;
+                    control::Process<Target> process{
+                          sense()
+                        , std::chrono::duration_cast<control::Time<Precision>>(wake - previous)
+                        };
+                    previous = wake;
+
+                    actuate(control::Value<Precision>(
+                        (static_cast<Target>(control::Value<Precision>(controllers(process))) + ...)
+                        ));
+
+                    Clock done = now();
+                    record(jitter, done - wake);
+                    while (done >= deadline + period_) {
+                        deadline += period_;
+                        timing_.overruns++;
+                    }
+                    published_.publish(timing_);
+                }
+            }
+        private:
+            static Clock
+            now() noexcept {
+                timespec ts;
+                clock_gettime(CLOCK_MONOTONIC, &ts);
+                return std::chrono::seconds(ts.tv_sec) + Clock(ts.tv_nsec);
+            }
+
+            static void
+            sleep(const Clock& deadline) noexcept {
+                timespec ts;
+                ts.tv_sec   = static_cast<time_t>(std::chrono::duration_cast<std::chrono::seconds>(deadline).count());
+                ts.tv_nsec  = static_cast<long>((deadline - std::chrono::seconds(ts.tv_sec)).count());
+                while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {}
+            }
+
+            void
+            record(const Clock& jitter, const Clock& latency) noexcept {
+                timing_.ticks++;
+                timing_.total_jitter += jitter;
+                if (jitter > timing_.worst_jitter) {
+                    timing_.worst_jitter = jitter;
+                }
+                if (latency > timing_.worst_latency) {
+                    timing_.worst_latency = latency;
+                }
+            }
+
+            Clock               period_;
+            std::atomic<bool>   stopping_;
+            Timing              timing_;
+            Latest<Timing>      published_;
+            Timing              latest_;
+    };
+} // namespace control
+
+#endif // CONTROL_LOOP_HPP__
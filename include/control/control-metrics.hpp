@@ -0,0 +1,115 @@
+#ifndef CONTROL_METRICS_HPP__
+#define CONTROL_METRICS_HPP__
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <ventilation/ventilation.hpp>
+
+#include "control-time.hpp"
+
+namespace control {
+    template <typename Precision>
+    struct Metrics {
+        Precision                   overshoot;
+        control::Time<Precision>    settling;
+        Precision                   iae;
+    };
+
+    template <typename Target>
+    Metrics<typename ventilation::precision<Target>::type>
+    evaluate(std::span<const Target> response
+        , const Target& initial
+        , const Target& target
+        , const control::Time<typename ventilation::precision<Target>::type>& period
+        , typename ventilation::precision<Target>::type band) {
+        static_assert(ventilation::is_airway_type<Target>::value);
+        using Precision = typename ventilation::precision<Target>::type;
+
+        const Precision setpoint    = static_cast<Precision>(target);
+        const Precision step        = setpoint - static_cast<Precision>(initial);
+        const Precision magnitude   = std::abs(step);
+        const Precision direction   = step < Precision() ? Precision(-1) : Precision(1);
+        const Precision tolerance   = band * magnitude;
+        const Precision dt          = period.count();
+
+        Precision peak          = Precision();
+        Precision iae           = Precision();
+        std::size_t settled     = 0;
+        for (std::size_t i = 0; i < response.size(); i++) {
+            Precision error = static_cast<Precision>(response[i]) - setpoint;
+            peak            = std::max(peak, error * direction);
+            iae            += std::abs(error) * dt;
+            settled         = std::abs(error) > tolerance ? i + 1 : settled;
+        }
+
+        return Metrics<Precision>{
+            magnitude > Precision() ? peak / magnitude : Precision(),
+            control::Time<Precision>(Precision(settled) * dt),
+            iae,
+        };
+    }
+
+    template <typename Precision>
+    class Summary {
+        public:
+            Summary()
+                : count_(0)
+                , overshoot_(Precision())
+                , settling_(Precision())
+                , iae_(Precision())
+                , worst_{Precision(), control::Time<Precision>(Precision()), Precision()}
+            {}
+
+            void
+            add(const Metrics<Precision>& metrics) noexcept {
+                count_++;
+                overshoot_         += metrics.overshoot;
+                settling_          += metrics.settling.count();
+                iae_               += metrics.iae;
+                worst_.overshoot    = std::max(worst_.overshoot, metrics.overshoot);
+                worst_.settling     = std::max(worst_.settling, metrics.settling);
+                worst_.iae          = std::max(worst_.iae, metrics.iae);
+            }
+
+            void
+            merge(const Summary& other) noexcept {
+                count_             += other.count_;
+                overshoot_         += other.overshoot_;
+                settling_          += other.settling_;
+                iae_               += other.iae_;
+                worst_.overshoot    = std::max(worst_.overshoot, other.worst_.overshoot);
+                worst_.settling     = std::max(worst_.settling, other.worst_.settling);
+                worst_.iae          = std::max(worst_.iae, other.worst_.iae);
+            }
+
+            std::size_t
+            count() const noexcept {
+                return count_;
+            }
+
+            Metrics<Precision>
+            mean() const noexcept {
+                Precision scale = count_ == 0 ? Precision() : Precision(1) / Precision(count_);
+                return Metrics<Precision>{
+                    overshoot_ * scale,
+                    control::Time<Precision>(settling_ * scale),
+                    iae_ * scale,
+                };
+            }
+
+            const Metrics<Precision>&
+            worst() const noexcept {
+                return worst_;
+            }
+        private:
+            std::size_t         count_;
+            Precision           overshoot_;
+            Precision           settling_;
+            Precision           iae_;
+            Metrics<Precision>  worst_;
+    };
+} // namespace control
+
+#endif // CONTROL_METRICS_HPP__
@@ -0,0 +1,20 @@
+#ifndef CONTROL_PARAMETERS_HPP__
+#define CONTROL_PARAMETERS_HPP__
+
+#include <ventilation/ventilation.hpp>
+
+#include "control-gain.hpp"
+
+namespace control {
+    template <typename Target>
+    struct Parameters {
+        static_assert(ventilation::is_airway_type<Target>::value);
+
+        Gain<Target>    proportional    = Gain<Target>();
+        Gain<Target>    integral        = Gain<Target>();
+        Gain<Target>    differential    = Gain<Target>();
+        Target          target          = Target();
+    };
+} // namespace control
+
+#endif // CONTROL_PARAMETERS_HPP__
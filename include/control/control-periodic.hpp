@@ -0,0 +1,122 @@
+#ifndef CONTROL_PERIODIC_HPP__
+#define CONTROL_PERIODIC_HPP__
+
+#include <ventilation/ventilation.hpp>
+
+#include "control-gain.hpp"
+#include "control-process.hpp"
+#include "control-time.hpp"
+#include "control-value.hpp"
+
+namespace control {
+    template <typename Target>
+    class PeriodicIntegral {
+        static_assert(ventilation::is_airway_type<Target>::value);
+        using Precision = typename ventilation::precision<Target>::type;
+        public:
+            constexpr PeriodicIntegral(const Gain<Target>& gain
+                , const Target& target
+                , const control::Time<Precision>& period)
+                : gain_(static_cast<Precision>(gain) * static_cast<Precision>(period.count()))
+                , target_(target)
+                , accumulator_(Target{})
+            {}
+
+            constexpr control::Value<Precision>
+            operator()(const control::Process<Target>& current) {
+                accumulator_ += current.error(target_);
+                return control::Value<Precision>(gain_ * accumulator_);
+            }
+
+            constexpr control::Value<Precision>
+            operator()(const control::Process<Target>& current, const Target& target) {
+                target_ = target;
+                return (*this)(current);
+            }
+        private:
+            Gain<Target>    gain_;
+            Target          target_;
+            Target          accumulator_;
+    };
+
+    template <typename Target>
+    class PeriodicDifferential {
+        static_assert(ventilation::is_airway_type<Target>::value);
+        using Precision = typename ventilation::precision<Target>::type;
+        public:
+            constexpr PeriodicDifferential(const Gain<Target>& gain
+                , const Target& target
+                , const control::Time<Precision>& period)
+                : gain_(static_cast<Precision>(gain) / static_cast<Precision>(period.count()))
+                , target_(target)
+                , previous_(Target{})
+            {}
+
+            constexpr control::Value<Precision>
+            operator()(const control::Process<Target>& current) {
+                Target error    = current.error(target_);
+                Target change   = error - previous_;
+                previous_       = error;
+
+                return control::Value<Precision>(gain_ * change);
+            }
+
+            constexpr control::Value<Precision>
+            operator()(const control::Process<Target>& current, const Target& target) {
+                target_ = target;
+                return (*this)(current);
+            }
+        private:
+            Gain<Target>    gain_;
+            Target          target_;
+            Target          previous_;
+    };
+
+    template <typename Target>
+    class PeriodicPID {
+        static_assert(ventilation::is_airway_type<Target>::value);
+        using Precision = typename ventilation::precision<Target>::type;
+        public:
+            constexpr PeriodicPID(const Gain<Target>& proportional
+                , const Gain<Target>& integral
+                , const Gain<Target>& differential
+                , const Target& target
+                , const control::Time<Precision>& period)
+                : proportional_(proportional)
+                , integral_(static_cast<Precision>(integral) * static_cast<Precision>(period.count()))
+                , differential_(static_cast<Precision>(differential) / static_cast<Precision>(period.count()))
+                , target_(target)
+                , accumulator_(Target{})
+                , previous_(Target{})
+            {}
+
+            constexpr control::Value<Precision>
+            operator()(const control::Process<Target>& current) {
+                Target error    = current.error(target_);
+                accumulator_   += error;
+                Target change   = error - previous_;
+                previous_       = error;
+
+                return control::Value<Precision>(
+                      proportional_ * error
+                    + integral_ * accumulator_
+                    + differential_ * change
+                    );
+            }
+
+            constexpr control::Value<Precision>
+            operator()(const control::Process<Target>& current, const Target& target) {
+                target_ = target;
+                return (*this)(current);
+            }
+        private:
+            Gain<Target>    proportional_;
+            Gain<Target>    integral_;
+            Gain<Target>    differential_;
+            Target          target_;
+            Target          accumulator_;
+            Target          previous_;
+    };
+} // namespace control
+
+#endif // CONTROL_PERIODIC_HPP__
@@ -0,0 +1,165 @@
+#ifndef CONTROL_PID_HPP__
+#define CONTROL_PID_HPP__
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <ventilation/ventilation.hpp>
+
+#include "control-gain.hpp"
+#include "control-parameters.hpp"
+#include "control-process.hpp"
+#include "control-saturation.hpp"
+#include "control-value.hpp"
+
+namespace control {
+    template <typename Target>
+    class PID {
+        static_assert(ventilation::is_airway_type<Target>::value);
+        using Precision = typename ventilation::precision<Target>::type;
+        public:
+            constexpr PID(const Gain<Target>& proportional
+                , const Gain<Target>& integral
+                , const Gain<Target>& differential
+                , const Target& target)
+                : proportional_(proportional)
+                , integral_(integral)
+                , differential_(differential)
+                , tracking_()
+                , recovery_()
+                , limits_()
+                , bounded_(false)
+                , target_(target)
+                , accumulator_(Target{})
+                , offset_(Target{})
+                , previous_(Target{})
+            {}
+
+            constexpr PID(const Gain<Target>& proportional
+                , const Gain<Target>& integral
+                , const Gain<Target>& differential
+                , const Target& target
+                , const Saturation<Target>& limits
+                , const Gain<Target>& tracking)
+                : proportional_(proportional)
+                , integral_(integral)
+                , differential_(differential)
+                , tracking_(tracking)
+                , recovery_(recovery(tracking, integral))
+                , limits_(limits)
+                , bounded_(true)
+                , target_(target)
+                , accumulator_(Target{})
+                , offset_(Target{})
+                , previous_(Target{})
+            {}
+
+            constexpr control::Value<Precision>
+            operator()(const control::Process<Target>& current) {
+                return control::Value<Precision>(bounded_
+                    ? step<true>(current, accumulator_, previous_)
+                    : step<false>(current, accumulator_, previous_)
+                    );
+            }
+
+            constexpr control::Value<Precision>
+            operator()(const control::Process<Target>& current, const Target& target) {
+                target_ = target;
+                return (*this)(current);
+            }
+
+            constexpr void
+            retune(const Parameters<Target>& parameters) noexcept {
+                Target held     = offset_ + integral_ * accumulator_;
+                Precision after = static_cast<Precision>(parameters.integral);
+                if (after == Precision()) {
+                    offset_         = held;
+                    accumulator_    = Target{};
+                } else {
+                    offset_         = Target{};
+                    accumulator_    = Target(static_cast<Precision>(held) / after);
+                }
+                previous_       = previous_ + (parameters.target - target_);
+
+                proportional_   = parameters.proportional;
+                integral_       = parameters.integral;
+                differential_   = parameters.differential;
+                recovery_       = recovery(tracking_, parameters.integral);
+                target_         = parameters.target;
+            }
+
+            constexpr void
+            gains(const Gain<Target>& proportional
+                , const Gain<Target>& integral
+                , const Gain<Target>& differential) noexcept {
+                proportional_   = proportional;
+                integral_       = integral;
+                differential_   = differential;
+                if (bounded_) {
+                    recovery_   = recovery(tracking_, integral);
+                }
+            }
+
+            constexpr void
+            operator()(std::span<const control::Process<Target>> current
+                , std::span<control::Value<Precision>> output) {
+                assert(output.size() >= current.size());
+                Target accumulator  = accumulator_;
+                Target previous     = previous_;
+                if (bounded_) {
+                    for (std::size_t i = 0; i < current.size(); i++) {
+                        output[i] = control::Value<Precision>(step<true>(current[i], accumulator, previous));
+                    }
+                } else {
+                    for (std::size_t i = 0; i < current.size(); i++) {
+                        output[i] = control::Value<Precision>(step<false>(current[i], accumulator, previous));
+                    }
+                }
+                accumulator_    = accumulator;
+                previous_       = previous;
+            }
+        private:
+            static constexpr Gain<Target>
+            recovery(const Gain<Target>& tracking, const Gain<Target>& integral) noexcept {
+                Precision gain = static_cast<Precision>(integral);
+                return gain == Precision()
+                    ? Gain<Target>()
+                    : Gain<Target>(static_cast<Precision>(tracking) / gain);
+            }
+
+            template <bool Bounded>
+            constexpr Target
+            step(const control::Process<Target>& current, Target& accumulator, Target& previous) const {
+                Target error        = current.error(target_);
+                accumulator        += error * current.count();
+                Target change       = differential_ * (error - previous);
+                previous            = error;
+
+                Target output       = proportional_ * error
+                                    + integral_ * accumulator
+                                    + offset_
+                                    + Target(static_cast<Precision>(change) / current.count());
+                if constexpr (Bounded) {
+                    Target limited  = limits_(output);
+                    accumulator    += recovery_ * (limited - output) * current.count();
+                    output          = limited;
+                }
+
+                return output;
+            }
+
+            Gain<Target>        proportional_;
+            Gain<Target>        integral_;
+            Gain<Target>        differential_;
+            Gain<Target>        tracking_;
+            Gain<Target>        recovery_;
+            Saturation<Target>  limits_;
+            bool                bounded_;
+            Target              target_;
+            Target              accumulator_;
+            Target              offset_;
+            Target              previous_;
+    };
+} // namespace control
+
+#endif // CONTROL_PID_HPP__
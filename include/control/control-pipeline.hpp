@@ -0,0 +1,50 @@
+#ifndef CONTROL_PIPELINE_HPP__
+#define CONTROL_PIPELINE_HPP__
+
+#include <concepts>
+#include <tuple>
+#include <utility>
+#include <ventilation/ventilation.hpp>
+
+#include "control-process.hpp"
+#include "control-value.hpp"
+
+namespace control {
+    template <typename T, typename Target>
+    concept Term = ventilation::is_airway_type<Target>::value
+        && requires(T& term, const control::Process<Target>& current) {
+            { term(current) } -> std::convertible_to<
+                control::Value<typename ventilation::precision<Target>::type>
+                >;
+        };
+
+    template <typename Target, Term<Target>... Terms>
+    class Pipeline {
+        static_assert(ventilation::is_airway_type<Target>::value);
+        static_assert(sizeof...(Terms) > 0);
+        using Precision = typename ventilation::precision<Target>::type;
+        public:
+            explicit constexpr Pipeline(const Terms&... terms)
+                : terms_(terms...)
+            {}
+
+            constexpr control::Value<Precision>
+            operator()(const control::Process<Target>& current) {
+                return std::apply([&current](Terms&... terms) {
+                    return control::Value<Precision>(
+                        (static_cast<Target>(control::Value<Precision>(terms(current))) + ...)
+                        );
+                }, terms_);
+            }
+
+            template <std::size_t I>
+            constexpr auto&
+            get() noexcept {
+                return std::get<I>(terms_);
+            }
+        private:
+            std::tuple<Terms...> terms_;
+    };
+} // namespace control
+
+#endif // CONTROL_PIPELINE_HPP__
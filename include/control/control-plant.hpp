@@ -0,0 +1,317 @@
+#ifndef CONTROL_PLANT_HPP__
+#define CONTROL_PLANT_HPP__
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <ventilation/ventilation.hpp>
+
+#include "control-heap.hpp"
+#include "control-time.hpp"
+
+namespace control {
+    template <typename Precision>
+    struct Airway {
+        ventilation::Pressure<Precision>    pressure;
+        ventilation::Flow<Precision>        flow;
+        ventilation::Volume<Precision>      volume;
+    };
+
+    template <typename Precision>
+    struct Mechanics {
+        Precision resistance;
+        Precision compliance;
+    };
+
+    template <typename Precision>
+    struct Admittance {
+        Precision conductance;
+        Precision flow;
+    };
+
+    template <typename Precision>
+    class Valve {
+        using Pressure = ventilation::Pressure<Precision>;
+        public:
+            Valve(const control::Time<Precision>& lag, Precision resistance)
+                : lag_(lag.count())
+                , conductance_(Precision(1) / resistance)
+                , pressure_(Precision())
+            {}
+
+            Precision
+            conductance() const noexcept {
+                return conductance_;
+            }
+
+            Pressure
+            operator()(const Pressure& command, const control::Time<Precision>& duration) noexcept {
+                Precision dt    = duration.count();
+                pressure_      += (static_cast<Precision>(command) - pressure_) * (dt / (lag_ + dt));
+                return Pressure(pressure_);
+            }
+        private:
+            Precision lag_;
+            Precision conductance_;
+            Precision pressure_;
+    };
+
+    template <typename Precision>
+    class Leak {
+        using Pressure  = ventilation::Pressure<Precision>;
+        using Flow      = ventilation::Flow<Precision>;
+        public:
+            explicit Leak(Precision conductance)
+                : conductance_(conductance)
+            {}
+
+            Precision
+            conductance() const noexcept {
+                return conductance_;
+            }
+
+            Flow
+            operator()(const Pressure& airway) const noexcept {
+                return Flow(conductance_ * static_cast<Precision>(airway));
+            }
+        private:
+            Precision conductance_;
+    };
+
+    template <typename Precision>
+    class Compartment {
+        using Pressure  = ventilation::Pressure<Precision>;
+        using Flow      = ventilation::Flow<Precision>;
+        using Volume    = ventilation::Volume<Precision>;
+        public:
+            Compartment(const Mechanics<Precision>& mechanics, const Pressure& peep)
+                : conductance_(Precision(1) / mechanics.resistance)
+                , elastance_(Precision(1) / mechanics.compliance)
+                , peep_(static_cast<Precision>(peep))
+                , volume_(Precision())
+            {}
+
+            Admittance<Precision>
+            admittance(const control::Time<Precision>& duration) const noexcept {
+                Precision slope = slope_(duration.count());
+                return Admittance<Precision>{slope, -(slope * recoil_())};
+            }
+
+            Airway<Precision>
+            operator()(const Pressure& airway, const control::Time<Precision>& duration) noexcept {
+                Precision dt        = duration.count();
+                Precision flow      = slope_(dt) * (static_cast<Precision>(airway) - recoil_());
+                volume_            += dt * flow;
+
+                return Airway<Precision>{airway, Flow(flow), Volume(volume_)};
+            }
+        private:
+            Precision
+            slope_(Precision dt) const noexcept {
+                return conductance_ / (Precision(1) + dt * conductance_ * elastance_);
+            }
+
+            Precision
+            recoil_() const noexcept {
+                return peep_ + elastance_ * volume_;
+            }
+
+
+            Precision conductance_;
+            Precision elastance_;
+            Precision peep_;
+            Precision volume_;
+    };
+
+    template <typename Precision>
+    class TwoCompartment {
+        using Pressure  = ventilation::Pressure<Precision>;
+        public:
+            TwoCompartment(const Mechanics<Precision>& first
+                , const Mechanics<Precision>& second
+                , const Pressure& peep)
+                : first_(first, peep)
+                , second_(second, peep)
+            {}
+
+            Admittance<Precision>
+            admittance(const control::Time<Precision>& duration) const noexcept {
+                Admittance<Precision> first     = first_.admittance(duration);
+                Admittance<Precision> second    = second_.admittance(duration);
+
+                return Admittance<Precision>{first.conductance + second.conductance, first.flow + second.flow};
+            }
+
+            Airway<Precision>
+            operator()(const Pressure& airway, const control::Time<Precision>& duration) noexcept {
+                Airway<Precision> first     = first_(airway, duration);
+                Airway<Precision> second    = second_(airway, duration);
+
+                return Airway<Precision>{airway, first.flow + second.flow, first.volume + second.volume};
+            }
+        private:
+            Compartment<Precision> first_;
+            Compartment<Precision> second_;
+    };
+
+    template <typename Precision, typename Lung = Compartment<Precision>>
+    class Plant {
+        using Pressure = ventilation::Pressure<Precision>;
+        public:
+            Plant(const Valve<Precision>& valve, const Lung& lung, const Leak<Precision>& leak)
+                : valve_(valve)
+                , lung_(lung)
+                , leak_(leak)
+            {}
+
+            Airway<Precision>
+            operator()(const Pressure& command, const control::Time<Precision>& duration) noexcept {
+                Precision source            = static_cast<Precision>(valve_(command, duration));
+                Admittance<Precision> lung  = lung_.admittance(duration);
+                Pressure airway((valve_.conductance() * source - lung.flow)
+                    / (valve_.conductance() + lung.conductance + leak_.conductance()));
+
+                Airway<Precision> state     = lung_(airway, duration);
+                state.flow                  = state.flow + leak_(airway);
+                return state;
+            }
+        private:
+            Valve<Precision>        valve_;
+            Lung                    lung_;
+            Leak<Precision>         leak_;
+    };
+
+    namespace detail {
+        template <typename Precision>
+        inline void
+        plant(std::size_t n
+            , Precision dt
+            , const Precision* __restrict lag
+            , const Precision* __restrict source
+            , const Precision* __restrict conductance
+            , const Precision* __restrict elastance
+            , const Precision* __restrict peep
+            , const Precision* __restrict leak
+            , const Precision* __restrict command
+            , Precision* __restrict valve
+            , Precision* __restrict airway
+            , Precision* __restrict volume
+            , Precision* __restrict flow) {
+            for (std::size_t i = 0; i < n; i++) {
+                Precision pressure  = valve[i] + (command[i] - valve[i]) * (dt / (lag[i] + dt));
+                Precision slope     = conductance[i] / (Precision(1) + dt * conductance[i] * elastance[i]);
+                Precision recoil    = peep[i] + elastance[i] * volume[i];
+                Precision node      = (source[i] * pressure + slope * recoil) / (source[i] + slope + leak[i]);
+                Precision inflow    = slope * (node - recoil);
+
+                flow[i]             = inflow + leak[i] * node;
+                valve[i]            = pressure;
+                airway[i]           = node;
+                volume[i]          += dt * inflow;
+            }
+        }
+    } // namespace detail
+
+    template <typename Precision, std::size_t N = std::dynamic_extent>
+    class Cohort {
+        using Pressure  = ventilation::Pressure<Precision>;
+        using Flow      = ventilation::Flow<Precision>;
+        using Volume    = ventilation::Volume<Precision>;
+        using Lanes     = typename detail::lanes<Precision, N>::type;
+        public:
+            Cohort() requires (N != std::dynamic_extent)
+                : lag_{}
+                , source_{}
+                , conductance_{}
+                , elastance_{}
+                , peep_{}
+                , leak_{}
+                , command_{}
+                , valve_{}
+                , airway_{}
+                , volume_{}
+                , flow_{}
+            {}
+
+            explicit Cohort(std::size_t patients) requires (N == std::dynamic_extent)
+                : lag_(patients)
+                , source_(patients)
+                , conductance_(patients)
+                , elastance_(patients)
+                , peep_(patients)
+                , leak_(patients)
+                , command_(patients)
+                , valve_(patients)
+                , airway_(patients)
+                , volume_(patients)
+                , flow_(patients)
+            {}
+
+            std::size_t
+            size() const noexcept {
+                return volume_.size();
+            }
+
+            void
+            assign(std::size_t patient
+                , const Mechanics<Precision>& mechanics
+                , const Pressure& peep
+                , const control::Time<Precision>& lag
+                , Precision resistance
+                , Precision leak) {
+                lag_[patient]           = lag.count();
+                source_[patient]        = Precision(1) / resistance;
+                conductance_[patient]   = Precision(1) / mechanics.resistance;
+                elastance_[patient]     = Precision(1) / mechanics.compliance;
+                peep_[patient]          = static_cast<Precision>(peep);
+                leak_[patient]          = leak;
+                valve_[patient]         = Precision();
+                airway_[patient]        = Precision();
+                volume_[patient]        = Precision();
+                flow_[patient]          = Precision();
+            }
+
+            void
+            operator()(std::span<const Pressure, N> commands
+                , const control::Time<Precision>& duration
+                , std::span<Airway<Precision>, N> output) {
+                const std::size_t n = size();
+                for (std::size_t i = 0; i < n; i++) {
+                    command_[i] = static_cast<Precision>(commands[i]);
+                }
+
+                detail::plant(n
+                    , duration.count()
+                    , std::assume_aligned<detail::alignment>(lag_.data())
+                    , std::assume_aligned<detail::alignment>(source_.data())
+                    , std::assume_aligned<detail::alignment>(conductance_.data())
+                    , std::assume_aligned<detail::alignment>(elastance_.data())
+                    , std::assume_aligned<detail::alignment>(peep_.data())
+                    , std::assume_aligned<detail::alignment>(leak_.data())
+                    , std::assume_aligned<detail::alignment>(command_.data())
+                    , std::assume_aligned<detail::alignment>(valve_.data())
+                    , std::assume_aligned<detail::alignment>(airway_.data())
+                    , std::assume_aligned<detail::alignment>(volume_.data())
+                    , std::assume_aligned<detail::alignment>(flow_.data())
+                    );
+
+                for (std::size_t i = 0; i < n; i++) {
+                    output[i] = Airway<Precision>{Pressure(airway_[i]), Flow(flow_[i]), Volume(volume_[i])};
+                }
+            }
+        private:
+            alignas(detail::alignment) Lanes lag_;
+            alignas(detail::alignment) Lanes source_;
+            alignas(detail::alignment) Lanes conductance_;
+            alignas(detail::alignment) Lanes elastance_;
+            alignas(detail::alignment) Lanes peep_;
+            alignas(detail::alignment) Lanes leak_;
+            alignas(detail::alignment) Lanes command_;
+            alignas(detail::alignment) Lanes valve_;
+            alignas(detail::alignment) Lanes airway_;
+            alignas(detail::alignment) Lanes volume_;
+            alignas(detail::alignment) Lanes flow_;
+    };
+} // namespace control
+
+#endif // CONTROL_PLANT_HPP__
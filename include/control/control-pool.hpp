@@ -0,0 +1,168 @@
+#ifndef CONTROL_POOL_HPP__
+#define CONTROL_POOL_HPP__
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "control-ring.hpp"
+
+namespace control {
+    class Pool {
+        struct alignas(CACHELINE) Queue {
+            std::mutex  mutex;
+            std::size_t begin   = 0;
+            std::size_t end     = 0;
+        };
+        public:
+            explicit Pool(std::size_t workers = std::thread::hardware_concurrency())
+                : queues_(std::make_unique<Queue[]>(std::max<std::size_t>(workers, 1)))
+                , workers_(std::max<std::size_t>(workers, 1))
+                , context_(nullptr)
+                , invoke_(nullptr)
+                , generation_(0)
+                , running_(0)
+                , stop_(false)
+            {
+                threads_.reserve(workers_ - 1);
+                for (std::size_t worker = 1; worker < workers_; worker++) {
+                    threads_.emplace_back([this, worker] { loop(worker); });
+                }
+            }
+
+            Pool(const Pool&) = delete;
+            Pool& operator=(const Pool&) = delete;
+
+            ~Pool() {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    stop_ = true;
+                }
+                start_.notify_all();
+                for (std::thread& thread : threads_) {
+                    thread.join();
+                }
+            }
+
+            std::size_t
+            size() const noexcept {
+                return workers_;
+            }
+
+            template <typename F>
+            void
+            operator()(std::size_t count, F&& task) {
+                using Task = std::remove_reference_t<F>;
+                for (std::size_t worker = 0; worker < workers_; worker++) {
+                    std::lock_guard<std::mutex> lock(queues_[worker].mutex);
+                    queues_[worker].begin   = count * worker / workers_;
+                    queues_[worker].end     = count * (worker + 1) / workers_;
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    context_    = const_cast<void*>(static_cast<const void*>(std::addressof(task)));
+                    invoke_     = [](void* context, std::size_t index, std::size_t worker) {
+                        (*static_cast<Task*>(context))(index, worker);
+                    };
+                    running_    = workers_;
+                    generation_++;
+                }
+                start_.notify_all();
+
+                work(0);
+
+                std::unique_lock<std::mutex> lock(mutex_);
+                done_.wait(lock, [this] { return running_ == 0; });
+                context_    = nullptr;
+                invoke_     = nullptr;
+            }
+        private:
+            void
+            loop(std::size_t worker) {
+                std::size_t seen = 0;
+                for (;;) {
+                    {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        start_.wait(lock, [this, seen] { return stop_ || generation_ != seen; });
+                        if (stop_) {
+                            return;
+                        }
+                        seen = generation_;
+                    }
+                    work(worker);
+                }
+            }
+
+            void
+            work(std::size_t worker) {
+                std::size_t index;
+                while (take(worker, index) || steal(worker, index)) {
+                    invoke_(context_, index, worker);
+                }
+
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (--running_ == 0) {
+                    done_.notify_all();
+                }
+            }
+
+            bool
+            take(std::size_t worker, std::size_t& index) {
+                Queue& queue = queues_[worker];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (queue.begin == queue.end) {
+                    return false;
+                }
+                index = queue.begin++;
+                return true;
+            }
+
+            bool
+            steal(std::size_t worker, std::size_t& index) {
+                for (std::size_t offset = 1; offset < workers_; offset++) {
+                    Queue& victim = queues_[(worker + offset) % workers_];
+                    std::size_t begin;
+                    std::size_t end;
+                    {
+                        std::lock_guard<std::mutex> lock(victim.mutex);
+                        std::size_t remaining = victim.end - victim.begin;
+                        if (remaining == 0) {
+                            continue;
+                        }
+                        end         = victim.end;
+                        begin       = end - (remaining + 1) / 2;
+                        victim.end  = begin;
+                    }
+
+                    index = begin;
+                    Queue& queue = queues_[worker];
+                    std::lock_guard<std::mutex> lock(queue.mutex);
+                    queue.begin = begin + 1;
+                    queue.end   = end;
+                    return true;
+                }
+                return false;
+            }
+
+            std::unique_ptr<Queue[]>    queues_;
+            std::size_t                 workers_;
+            std::vector<std::thread>    threads_;
+            void*                       context_;
+            void                        (*invoke_)(void*, std::size_t, std::size_t);
+            std::mutex                  mutex_;
+            std::condition_variable     start_;
+            std::condition_variable     done_;
+            std::size_t                 generation_;
+            std::size_t                 running_;
+            bool                        stop_;
+    };
+} // namespace control
+
+#endif // CONTROL_POOL_HPP__
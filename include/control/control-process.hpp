@@ -15,12 +15,12 @@ namespace control {
         T                           measurement;
         control::Time<Precision>    duration;
 
-        T
+        constexpr T
         error(const T& target) const {
             return target - measurement;
         }
 
-        Precision
+        constexpr Precision
         count() const {
             return static_cast<Precision>(duration.count());
         }
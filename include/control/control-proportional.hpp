@@ -1,10 +1,13 @@
 #ifndef CONTROL_PROPORTIONAL_HPP__
 #define CONTROL_PROPORTIONAL_HPP__
 
-#include <ostream>
+#include <cassert>
+#include <cstddef>
+#include <span>
 #include <ventilation/ventilation.hpp>
 
 #include "control-gain.hpp"
+#include "control-parameters.hpp"
 #include "control-process.hpp"
 #include "control-value.hpp"
 
@@ -14,15 +17,43 @@ namespace control {
         static_assert(ventilation::is_airway_type<Target>::value);
         using Precision = typename ventilation::precision<Target>::type;
         public:
-            Proportional(const Gain<Target>& gain, const Target& target)
+            constexpr Proportional(const Gain<Target>& gain, const Target& target)
                 : gain_(gain)
                 , target_(target)
             {}
 
-            control::Value<Precision>
+            constexpr control::Value<Precision>
             operator()(const control::Process<Target>& current) {
                 return control::Value<Precision>(gain_ * current.error(target_));
             }
+
+            constexpr control::Value<Precision>
+            operator()(const control::Process<Target>& current, const Target& target) {
+                target_ = target;
+                return (*this)(current);
+            }
+
+            constexpr void
+            retune(const Gain<Target>& gain, const Target& target) noexcept {
+                gain_   = gain;
+                target_ = target;
+            }
+
+            constexpr void
+            retune(const Parameters<Target>& parameters) noexcept {
+                retune(parameters.proportional, parameters.target);
+            }
+
+            constexpr void
+            operator()(std::span<const control::Process<Target>> current
+                , std::span<control::Value<Precision>> output) const {
+                assert(output.size() >= current.size());
+                const Gain<Target> gain     = gain_;
+                const Target target         = target_;
+                for (std::size_t i = 0; i < current.size(); i++) {
+                    output[i] = control::Value<Precision>(gain * current[i].error(target));
+                }
+            }
         private:
             Gain<Target> gain_;
             Target       target_;
@@ -0,0 +1,152 @@
+#ifndef CONTROL_REPLAY_HPP__
+#define CONTROL_REPLAY_HPP__
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+#include <ventilation/ventilation.hpp>
+
+#include "control-pool.hpp"
+#include "control-process.hpp"
+#include "control-time.hpp"
+#include "control-trace.hpp"
+
+namespace control {
+    template <typename Precision>
+    struct Divergence {
+        std::size_t     index;
+        std::uint64_t   timestamp;
+        Precision       recorded;
+        Precision       replayed;
+    };
+
+    template <typename Precision>
+    struct Report {
+        std::size_t                             samples;
+        std::size_t                             diverged;
+        Precision                               worst;
+        std::optional<Divergence<Precision>>    first;
+    };
+
+    template <typename Target, typename Controller>
+    class Replay {
+        static_assert(ventilation::is_airway_type<Target>::value);
+        using Precision = typename ventilation::precision<Target>::type;
+        using Record    = trace::Record<Precision>;
+        public:
+            Replay(std::vector<Controller> candidates
+                , std::uint32_t channel
+                , Precision tolerance = Precision()
+                , std::size_t chunk = 4096)
+                : candidates_(std::move(candidates))
+                , reports_(candidates_.size(), Report<Precision>{0, 0, Precision(), std::nullopt})
+                , channel_(channel)
+                , tolerance_(tolerance)
+                , chunk_(std::max<std::size_t>(chunk, 1))
+                , index_(0)
+                , processes_()
+                , targets_()
+                , recorded_()
+                , timestamps_()
+            {
+                processes_.reserve(chunk_);
+                targets_.reserve(chunk_);
+                recorded_.reserve(chunk_);
+                timestamps_.reserve(chunk_);
+            }
+
+            void
+            operator()(std::span<const Record> records) {
+                for (std::size_t begin = 0; begin < records.size(); begin += chunk_) {
+                    stage(records.subspan(begin, std::min(chunk_, records.size() - begin)));
+                    for (std::size_t candidate = 0; candidate < candidates_.size(); candidate++) {
+                        run(candidate);
+                    }
+                    index_ += processes_.size();
+                }
+            }
+
+            void
+            operator()(Pool& pool, std::span<const Record> records) {
+                for (std::size_t begin = 0; begin < records.size(); begin += chunk_) {
+                    stage(records.subspan(begin, std::min(chunk_, records.size() - begin)));
+                    pool(candidates_.size(), [this](std::size_t candidate, std::size_t) {
+                        run(candidate);
+                    });
+                    index_ += processes_.size();
+                }
+            }
+
+            std::size_t
+            size() const noexcept {
+                return candidates_.size();
+            }
+
+            const Report<Precision>&
+            report(std::size_t candidate) const noexcept {
+                return reports_[candidate];
+            }
+
+            const Controller&
+            candidate(std::size_t candidate) const noexcept {
+                return candidates_[candidate];
+            }
+        private:
+            void
+            stage(std::span<const Record> records) {
+                processes_.clear();
+                targets_.clear();
+                recorded_.clear();
+                timestamps_.clear();
+                for (const Record& record : records) {
+                    if (record.channel != channel_) {
+                        continue;
+                    }
+
+                    processes_.push_back(control::Process<Target>{
+                          Target(record.measurement)
+                        , control::Time<Precision>(record.duration)
+                        });
+                    targets_.push_back(Target(record.target));
+                    recorded_.push_back(record.output);
+                    timestamps_.push_back(record.timestamp);
+                }
+            }
+
+            void
+            run(std::size_t candidate) {
+                Controller& controller      = candidates_[candidate];
+                Report<Precision>& report   = reports_[candidate];
+                for (std::size_t i = 0; i < processes_.size(); i++) {
+                    Precision replayed  = static_cast<Precision>(Target(controller(processes_[i], targets_[i])));
+                    Precision error     = std::abs(replayed - recorded_[i]);
+                    report.samples++;
+                    if (!(error <= tolerance_)) {
+                        report.diverged++;
+                        report.worst = std::max(report.worst, error);
+                        if (!report.first) {
+                            report.first = Divergence<Precision>{index_ + i, timestamps_[i], recorded_[i], replayed};
+                        }
+                    }
+                }
+            }
+
+            std::vector<Controller>                 candidates_;
+            std::vector<Report<Precision>>          reports_;
+            std::uint32_t                           channel_;
+            Precision                               tolerance_;
+            std::size_t                             chunk_;
+            std::size_t                             index_;
+            std::vector<control::Process<Target>>   processes_;
+            std::vector<Target>                     targets_;
+            std::vector<Precision>                  recorded_;
+            std::vector<std::uint64_t>              timestamps_;
+    };
+} // namespace control
+
+#endif // CONTROL_REPLAY_HPP__
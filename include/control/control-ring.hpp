@@ -0,0 +1,132 @@
+#ifndef CONTROL_RING_HPP__
+#define CONTROL_RING_HPP__
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace control {
+    inline constexpr std::size_t CACHELINE = 64;
+
+    template <typename T, std::size_t Capacity>
+    class Ring {
+        static_assert(std::is_trivially_copyable<T>::value);
+        static_assert(Capacity > 1 && (Capacity & (Capacity - 1)) == 0);
+        static constexpr std::size_t MASK = Capacity - 1;
+        public:
+            Ring() noexcept
+                : head_(0)
+                , tail_cache_(0)
+                , tail_(0)
+                , head_cache_(0)
+                , slots_{}
+            {}
+
+            Ring(const Ring&) = delete;
+            Ring& operator=(const Ring&) = delete;
+
+            bool
+            push(const T& value) noexcept {
+                return push(std::span<const T>(&value, 1)) == 1;
+            }
+
+            bool
+            pop(T& value) noexcept {
+                return pop(std::span<T>(&value, 1)) == 1;
+            }
+
+            std::size_t
+            push(std::span<const T> values) noexcept {
+                const std::size_t head = head_.load(std::memory_order_relaxed);
+                if (Capacity - (head - tail_cache_) < values.size()) {
+                    tail_cache_ = tail_.load(std::memory_order_acquire);
+                }
+
+                const std::size_t count = std::min(values.size(), Capacity - (head - tail_cache_));
+                for (std::size_t i = 0; i < count; i++) {
+                    slots_[(head + i) & MASK] = values[i];
+                }
+                head_.store(head + count, std::memory_order_release);
+                return count;
+            }
+
+            std::size_t
+            pop(std::span<T> values) noexcept {
+                const std::size_t tail = tail_.load(std::memory_order_relaxed);
+                if (head_cache_ - tail < values.size()) {
+                    head_cache_ = head_.load(std::memory_order_acquire);
+                }
+
+                const std::size_t count = std::min(values.size(), head_cache_ - tail);
+                for (std::size_t i = 0; i < count; i++) {
+                    values[i] = slots_[(tail + i) & MASK];
+                }
+                tail_.store(tail + count, std::memory_order_release);
+                return count;
+            }
+
+            std::size_t
+            size() const noexcept {
+                return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+            }
+
+            static constexpr std::size_t
+            capacity() noexcept {
+                return Capacity;
+            }
+        private:
+            alignas(CACHELINE) std::atomic<std::size_t> head_;
+            std::size_t                                 tail_cache_;
+            alignas(CACHELINE) std::atomic<std::size_t> tail_;
+            std::size_t                                 head_cache_;
+            alignas(CACHELINE) std::array<T, Capacity>  slots_;
+    };
+
+    template <typename T>
+    class Latest {
+        static_assert(std::is_trivially_copyable<T>::value);
+        static constexpr std::uint8_t FRESH = 0x4;
+        static constexpr std::uint8_t INDEX = 0x3;
+        public:
+            Latest() noexcept
+                : back_(0)
+                , middle_(1)
+                , front_(2)
+                , slots_{}
+            {}
+
+            Latest(const Latest&) = delete;
+            Latest& operator=(const Latest&) = delete;
+
+            void
+            publish(const T& value) noexcept {
+                slots_[back_].value = value;
+                back_ = middle_.exchange(back_ | FRESH, std::memory_order_acq_rel) & INDEX;
+            }
+
+            bool
+            poll(T& value) noexcept {
+                if ((middle_.load(std::memory_order_relaxed) & FRESH) == 0) {
+                    return false;
+                }
+                front_  = middle_.exchange(front_, std::memory_order_acq_rel) & INDEX;
+                value   = slots_[front_].value;
+                return true;
+            }
+        private:
+            struct alignas(CACHELINE) Slot {
+                T value;
+            };
+
+            alignas(CACHELINE) std::uint8_t                 back_;
+            alignas(CACHELINE) std::atomic<std::uint8_t>    middle_;
+            alignas(CACHELINE) std::uint8_t                 front_;
+            std::array<Slot, 3>                             slots_;
+    };
+} // namespace control
+
+#endif // CONTROL_RING_HPP__
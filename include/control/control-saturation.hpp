@@ -0,0 +1,60 @@
+#ifndef CONTROL_SATURATION_HPP__
+#define CONTROL_SATURATION_HPP__
+
+#include <algorithm>
+#include <limits>
+#include <ventilation/ventilation.hpp>
+
+#include "control-gain.hpp"
+
+namespace control {
+    template <typename Target>
+    class Saturation {
+        static_assert(ventilation::is_airway_type<Target>::value);
+        using Precision = typename ventilation::precision<Target>::type;
+        public:
+            constexpr Saturation()
+                : lower_(std::numeric_limits<Precision>::lowest())
+                , upper_(std::numeric_limits<Precision>::max())
+            {}
+
+            constexpr Saturation(const Target& lower, const Target& upper)
+                : lower_(static_cast<Precision>(lower))
+                , upper_(static_cast<Precision>(upper))
+            {}
+
+            constexpr Target
+            lower() const noexcept {
+                return Target(lower_);
+            }
+
+            constexpr Target
+            upper() const noexcept {
+                return Target(upper_);
+            }
+
+            constexpr Target
+            operator()(const Target& value) const noexcept {
+                return Target(std::min(std::max(static_cast<Precision>(value), lower_), upper_));
+            }
+
+            constexpr Saturation
+            operator/(const Gain<Target>& gain) const noexcept {
+                Precision scale = static_cast<Precision>(gain);
+                if (scale == Precision()) {
+                    return Saturation();
+                }
+
+                Precision lower = lower_ / scale;
+                Precision upper = upper_ / scale;
+                return scale < Precision()
+                    ? Saturation(Target(upper), Target(lower))
+                    : Saturation(Target(lower), Target(upper));
+            }
+        private:
+            Precision lower_;
+            Precision upper_;
+    };
+} // namespace control
+
+#endif // CONTROL_SATURATION_HPP__
@@ -0,0 +1,138 @@
+#ifndef CONTROL_SCHEDULE_HPP__
+#define CONTROL_SCHEDULE_HPP__
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <ventilation/ventilation.hpp>
+
+#include "control-gain.hpp"
+#include "control-pid.hpp"
+#include "control-process.hpp"
+#include "control-value.hpp"
+
+namespace control {
+    template <typename Target>
+    struct Breakpoint {
+        static_assert(ventilation::is_airway_type<Target>::value);
+
+        Gain<Target>    proportional    = Gain<Target>();
+        Gain<Target>    integral        = Gain<Target>();
+        Gain<Target>    differential    = Gain<Target>();
+    };
+
+    template <typename Target, typename Variable, std::size_t N>
+    class Schedule {
+        static_assert(ventilation::is_airway_type<Target>::value);
+        static_assert(ventilation::is_airway_type<Variable>::value);
+        static_assert(N >= 2);
+        using Precision = typename ventilation::precision<Target>::type;
+
+        struct Row {
+            Precision proportional;
+            Precision integral;
+            Precision differential;
+        };
+        public:
+            constexpr Schedule(const Variable& lower
+                , const Variable& upper
+                , const std::array<Breakpoint<Target>, N>& table)
+                : uniform_(true)
+                , lower_(static_cast<Precision>(lower))
+                , scale_(Precision(N - 1) / (static_cast<Precision>(upper) - static_cast<Precision>(lower)))
+                , positions_()
+                , reciprocals_()
+                , rows_(rows(table))
+            {}
+
+            constexpr Schedule(const std::array<Variable, N>& positions
+                , const std::array<Breakpoint<Target>, N>& table)
+                : uniform_(false)
+                , lower_(static_cast<Precision>(positions[0]))
+                , scale_(Precision())
+                , positions_()
+                , reciprocals_()
+                , rows_(rows(table))
+            {
+                for (std::size_t i = 0; i < N; i++) {
+                    positions_[i] = static_cast<Precision>(positions[i]);
+                }
+                for (std::size_t i = 0; i + 1 < N; i++) {
+                    reciprocals_[i] = Precision(1) / (positions_[i + 1] - positions_[i]);
+                }
+            }
+
+            constexpr Breakpoint<Target>
+            operator()(const Variable& scheduling) const noexcept {
+                Precision x         = static_cast<Precision>(scheduling);
+                std::size_t index   = 0;
+                Precision fraction  = Precision();
+                if (uniform_) {
+                    Precision position  = std::min(std::max((x - lower_) * scale_, Precision()), Precision(N - 1));
+                    index               = std::min(static_cast<std::size_t>(position), N - 2);
+                    fraction            = position - Precision(index);
+                } else {
+                    for (std::size_t step = std::bit_floor(N - 1); step > 0; step >>= 1) {
+                        std::size_t next    = index + step;
+                        index               = (next < N - 1 && positions_[next] <= x) ? next : index;
+                    }
+                    fraction = std::min(std::max((x - positions_[index]) * reciprocals_[index], Precision()), Precision(1));
+                }
+
+                const Row& lo = rows_[index];
+                const Row& hi = rows_[index + 1];
+                return Breakpoint<Target>{
+                    Gain<Target>(lo.proportional + (hi.proportional - lo.proportional) * fraction),
+                    Gain<Target>(lo.integral + (hi.integral - lo.integral) * fraction),
+                    Gain<Target>(lo.differential + (hi.differential - lo.differential) * fraction),
+                };
+            }
+        private:
+            static constexpr std::array<Row, N>
+            rows(const std::array<Breakpoint<Target>, N>& table) noexcept {
+                std::array<Row, N> result;
+                for (std::size_t i = 0; i < N; i++) {
+                    result[i] = Row{
+                        static_cast<Precision>(table[i].proportional),
+                        static_cast<Precision>(table[i].integral),
+                        static_cast<Precision>(table[i].differential),
+                    };
+                }
+                return result;
+            }
+
+            bool                        uniform_;
+            Precision                   lower_;
+            Precision                   scale_;
+            std::array<Precision, N>    positions_;
+            std::array<Precision, N>    reciprocals_;
+            std::array<Row, N>          rows_;
+    };
+
+    template <typename Target, typename Variable, std::size_t N>
+    class Scheduled {
+        static_assert(ventilation::is_airway_type<Target>::value);
+        using Precision = typename ventilation::precision<Target>::type;
+        public:
+            constexpr Scheduled(const Schedule<Target, Variable, N>& schedule, const Target& target)
+                : schedule_(schedule)
+                , pid_(Gain<Target>(), Gain<Target>(), Gain<Target>(), target)
+            {
+                Breakpoint<Target> gains = schedule_(Variable());
+                pid_.gains(gains.proportional, gains.integral, gains.differential);
+            }
+
+            constexpr control::Value<Precision>
+            operator()(const control::Process<Target>& current, const Variable& scheduling) {
+                Breakpoint<Target> gains = schedule_(scheduling);
+                pid_.gains(gains.proportional, gains.integral, gains.differential);
+                return pid_(current);
+            }
+        private:
+            Schedule<Target, Variable, N>   schedule_;
+            PID<Target>                     pid_;
+    };
+} // namespace control
+
+#endif // CONTROL_SCHEDULE_HPP__
@@ -0,0 +1,175 @@
+#ifndef CONTROL_SCHEDULER_HPP__
+#define CONTROL_SCHEDULER_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <ventilation/ventilation.hpp>
+
+#include "control-instrument.hpp"
+#include "control-process.hpp"
+#include "control-time.hpp"
+
+namespace control {
+    template <typename Controller, typename Sense, typename Actuate>
+    class Group {
+        public:
+            using Target    = std::remove_cvref_t<std::invoke_result_t<Sense&>>;
+            using Precision = typename ventilation::precision<Target>::type;
+            static_assert(ventilation::is_airway_type<Target>::value);
+
+            Group(const Controller& controller, std::size_t divisor, Sense sense, Actuate actuate)
+                : controller_(controller)
+                , sense_(std::move(sense))
+                , actuate_(std::move(actuate))
+                , divisor_(divisor)
+                , countdown_(0)
+                , elapsed_(Precision())
+            {
+                assert(divisor_ > 0);
+            }
+
+            std::size_t
+            divisor() const noexcept {
+                return divisor_;
+            }
+
+            void
+            phase(std::size_t phase) noexcept {
+                countdown_ = phase % divisor_;
+            }
+
+            void
+            operator()(const control::Time<Precision>& duration) {
+                elapsed_ += duration;
+                if (countdown_ == 0) {
+                    actuate_(controller_(control::Process<Target>{sense_(), elapsed_}));
+                    countdown_  = divisor_;
+                    elapsed_    = control::Time<Precision>(Precision());
+                }
+                countdown_--;
+            }
+
+            Controller&
+            get() noexcept {
+                return controller_;
+            }
+        private:
+            Controller                  controller_;
+            Sense                       sense_;
+            Actuate                     actuate_;
+            std::size_t                 divisor_;
+            std::size_t                 countdown_;
+            control::Time<Precision>    elapsed_;
+    };
+
+    template <typename... Groups>
+    class Scheduler {
+        static_assert(sizeof...(Groups) > 0);
+        using Precision = typename std::tuple_element_t<0, std::tuple<Groups...>>::Precision;
+        static_assert((std::is_same<typename Groups::Precision, Precision>::value && ...));
+        static constexpr std::size_t N = sizeof...(Groups);
+        public:
+            explicit Scheduler(Groups... groups)
+                : groups_(std::move(groups)...)
+                , phases_{}
+                , worst_()
+                , phase_(0)
+            {
+                std::array<std::size_t, N> divisors = std::apply([](const Groups&... g) {
+                    return std::array<std::size_t, N>{g.divisor()...};
+                }, groups_);
+
+                std::size_t hyperperiod = 1;
+                for (std::size_t divisor : divisors) {
+                    hyperperiod = std::lcm(hyperperiod, divisor);
+                }
+                worst_.assign(hyperperiod, 0);
+
+                std::array<std::size_t, N> order;
+                std::iota(order.begin(), order.end(), std::size_t(0));
+                std::stable_sort(order.begin(), order.end(), [&divisors](std::size_t lhs, std::size_t rhs) {
+                    return divisors[lhs] < divisors[rhs];
+                });
+
+                std::vector<std::size_t> load(hyperperiod, 0);
+                for (std::size_t index : order) {
+                    std::size_t divisor = divisors[index];
+                    std::size_t best    = 0;
+                    std::size_t lowest  = static_cast<std::size_t>(-1);
+                    for (std::size_t phase = 0; phase < divisor; phase++) {
+                        std::size_t peak = 0;
+                        for (std::size_t tick = phase; tick < hyperperiod; tick += divisor) {
+                            peak = std::max(peak, load[tick]);
+                        }
+                        if (peak < lowest) {
+                            lowest  = peak;
+                            best    = phase;
+                        }
+                    }
+                    for (std::size_t tick = best; tick < hyperperiod; tick += divisor) {
+                        load[tick]++;
+                    }
+                    phases_[index] = best;
+                }
+
+                std::apply([this](Groups&... g) {
+                    std::size_t index = 0;
+                    (g.phase(phases_[index++]), ...);
+                }, groups_);
+            }
+
+            void
+            operator()(const control::Time<Precision>& duration) {
+                std::uint64_t start = control::cycles();
+                std::apply([&duration](Groups&... g) {
+                    (g(duration), ...);
+                }, groups_);
+                std::uint64_t cost = control::cycles() - start;
+
+                worst_[phase_]  = std::max(worst_[phase_], cost);
+                phase_          = phase_ + 1 == worst_.size() ? 0 : phase_ + 1;
+            }
+
+            std::size_t
+            hyperperiod() const noexcept {
+                return worst_.size();
+            }
+
+            std::size_t
+            phase(std::size_t group) const noexcept {
+                return phases_[group];
+            }
+
+            std::span<const std::uint64_t>
+            worst() const noexcept {
+                return worst_;
+            }
+
+            void
+            reset() noexcept {
+                std::fill(worst_.begin(), worst_.end(), 0);
+            }
+
+            template <std::size_t I>
+            auto&
+            get() noexcept {
+                return std::get<I>(groups_).get();
+            }
+        private:
+            std::tuple<Groups...>       groups_;
+            std::array<std::size_t, N>  phases_;
+            std::vector<std::uint64_t>  worst_;
+            std::size_t                 phase_;
+    };
+} // namespace control
+
+#endif // CONTROL_SCHEDULER_HPP__
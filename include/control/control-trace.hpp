@@ -0,0 +1,276 @@
+#ifndef CONTROL_TRACE_HPP__
+#define CONTROL_TRACE_HPP__
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <span>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <type_traits>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+#include "control-ring.hpp"
+
+namespace control::trace {
+    inline constexpr std::array<char, 8> MAGIC      = {'C', 'T', 'L', 'T', 'R', 'A', 'C', 'E'};
+    inline constexpr std::uint32_t VERSION          = 3;
+
+    struct Header {
+        std::array<char, 8> magic;
+        std::uint32_t       version;
+        std::uint32_t       precision;
+        std::uint32_t       record;
+        std::uint32_t       reserved;
+    };
+
+    template <typename Precision>
+    struct Record {
+        std::uint64_t   timestamp;
+        std::uint32_t   channel;
+        std::uint32_t   flags;
+        Precision       duration;
+        Precision       measurement;
+        Precision       target;
+        Precision       proportional;
+        Precision       integral;
+        Precision       differential;
+        Precision       output;
+        Precision       reserved;
+    };
+
+    static_assert(sizeof(Record<float>) == 48);
+    static_assert(sizeof(Record<double>) == 80);
+
+    template <typename Precision>
+    constexpr Header
+    header() noexcept {
+        return Header{
+            MAGIC,
+            VERSION,
+            static_cast<std::uint32_t>(sizeof(Precision)),
+            static_cast<std::uint32_t>(sizeof(Record<Precision>)),
+            0,
+        };
+    }
+
+    template <typename Precision>
+    class Writer {
+        static_assert(std::is_floating_point<Precision>::value);
+        static_assert(std::is_trivially_copyable<Record<Precision>>::value);
+        static_assert(sizeof(Header) % alignof(Record<Precision>) == 0);
+        static constexpr std::size_t BLOCKS = 8;
+        static constexpr std::size_t NONE   = BLOCKS;
+
+        struct Block {
+            std::size_t index;
+            std::size_t count;
+        };
+        public:
+            explicit Writer(const char* path, std::size_t capacity = 4096)
+                : file_(std::fopen(path, "wb"))
+                , capacity_(capacity > 0 ? capacity : 1)
+                , buffer_(capacity_ * BLOCKS)
+                , current_(0)
+                , size_(0)
+                , submitted_(0)
+                , dropped_(0)
+                , written_(0)
+                , good_(file_ != nullptr)
+                , running_(true)
+                , full_()
+                , free_()
+                , thread_()
+            {
+                for (std::size_t i = 1; i < BLOCKS; i++) {
+                    free_.push(i);
+                }
+                if (file_ != nullptr) {
+                    std::setvbuf(file_, nullptr, _IONBF, 0);
+                    Header h = header<Precision>();
+                    good_.store(std::fwrite(&h, sizeof(h), 1, file_) == 1, std::memory_order_relaxed);
+                    thread_ = std::thread([this] { drain(); });
+                }
+            }
+
+            Writer(const Writer&) = delete;
+            Writer& operator=(const Writer&) = delete;
+
+            ~Writer() {
+                if (file_ != nullptr) {
+                    flush();
+                    running_.store(false, std::memory_order_release);
+                    thread_.join();
+                    std::fclose(file_);
+                }
+            }
+
+            explicit operator bool() const noexcept {
+                return good_.load(std::memory_order_acquire);
+            }
+
+            void
+            operator()(const Record<Precision>& record) noexcept {
+                if (current_ == NONE && !free_.pop(current_)) {
+                    dropped_++;
+                    return;
+                }
+
+                Record<Precision>& slot = buffer_[current_ * capacity_ + size_++];
+                slot                    = record;
+                slot.reserved           = Precision();
+                if (size_ == capacity_) {
+                    submit();
+                }
+            }
+
+            bool
+            flush() noexcept {
+                submit();
+                if (file_ == nullptr) {
+                    return false;
+                }
+                while (written_.load(std::memory_order_acquire) != submitted_) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                }
+                return good_.load(std::memory_order_acquire);
+            }
+
+            std::uint64_t
+            dropped() const noexcept {
+                return dropped_;
+            }
+        private:
+            void
+            submit() noexcept {
+                if (current_ == NONE || size_ == 0) {
+                    return;
+                }
+
+                full_.push(Block{current_, size_});
+                submitted_++;
+                size_ = 0;
+                if (!free_.pop(current_)) {
+                    current_ = NONE;
+                }
+            }
+
+            void
+            drain() noexcept {
+                Block block;
+                for (;;) {
+                    if (full_.pop(block)) {
+                        if (good_.load(std::memory_order_relaxed)) {
+                            bool good = std::fwrite(buffer_.data() + block.index * capacity_
+                                , sizeof(Record<Precision>), block.count, file_) == block.count;
+                            good_.store(good, std::memory_order_relaxed);
+                        }
+                        free_.push(block.index);
+                        written_.fetch_add(1, std::memory_order_release);
+                    } else if (running_.load(std::memory_order_acquire)) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    } else {
+                        return;
+                    }
+                }
+            }
+
+            std::FILE*                      file_;
+            std::size_t                     capacity_;
+            std::vector<Record<Precision>>  buffer_;
+            std::size_t                     current_;
+            std::size_t                     size_;
+            std::uint64_t                   submitted_;
+            std::uint64_t                   dropped_;
+            std::atomic<std::uint64_t>      written_;
+            std::atomic<bool>               good_;
+            std::atomic<bool>               running_;
+            Ring<Block, BLOCKS>             full_;
+            Ring<std::size_t, BLOCKS>       free_;
+            std::thread                     thread_;
+    };
+
+    template <typename Precision>
+    class Reader {
+        static_assert(std::is_floating_point<Precision>::value);
+        public:
+            explicit Reader(const char* path)
+                : data_(nullptr)
+                , length_(0)
+                , records_()
+                , valid_(false)
+            {
+                int fd = ::open(path, O_RDONLY);
+                if (fd < 0) {
+                    return;
+                }
+
+                struct stat status;
+                if (::fstat(fd, &status) == 0 && static_cast<std::size_t>(status.st_size) >= sizeof(Header)) {
+                    length_ = static_cast<std::size_t>(status.st_size);
+                    void* data = ::mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+                    data_ = data == MAP_FAILED ? nullptr : data;
+                }
+                ::close(fd);
+                if (data_ == nullptr) {
+                    return;
+                }
+
+                Header h;
+                std::memcpy(&h, data_, sizeof(h));
+                Header expected = header<Precision>();
+                if (h.magic != expected.magic
+                    || h.version != expected.version
+                    || h.precision != expected.precision
+                    || h.record != expected.record) {
+                    return;
+                }
+
+                ::madvise(data_, length_, MADV_SEQUENTIAL);
+                const auto* first = reinterpret_cast<const Record<Precision>*>(static_cast<const char*>(data_) + sizeof(Header));
+                records_ = std::span<const Record<Precision>>(first, (length_ - sizeof(Header)) / sizeof(Record<Precision>));
+                valid_ = true;
+            }
+
+            Reader(Reader&& other) noexcept
+                : data_(std::exchange(other.data_, nullptr))
+                , length_(std::exchange(other.length_, 0))
+                , records_(std::exchange(other.records_, {}))
+                , valid_(std::exchange(other.valid_, false))
+            {}
+
+            Reader(const Reader&) = delete;
+            Reader& operator=(const Reader&) = delete;
+            Reader& operator=(Reader&&) = delete;
+
+            ~Reader() {
+                if (data_ != nullptr) {
+                    ::munmap(data_, length_);
+                }
+            }
+
+            explicit operator bool() const noexcept {
+                return valid_;
+            }
+
+            std::span<const Record<Precision>>
+            records() const noexcept {
+                return records_;
+            }
+        private:
+            void*                               data_;
+            std::size_t                         length_;
+            std::span<const Record<Precision>>  records_;
+            bool                                valid_;
+    };
+} // namespace control::trace
+
+#endif // CONTROL_TRACE_HPP__
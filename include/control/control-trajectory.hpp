@@ -0,0 +1,137 @@
+#ifndef CONTROL_TRAJECTORY_HPP__
+#define CONTROL_TRAJECTORY_HPP__
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <span>
+#include <utility>
+#include <vector>
+#include <ventilation/ventilation.hpp>
+
+#include "control-time.hpp"
+
+namespace control {
+    template <typename Target>
+    class Trajectory {
+        static_assert(ventilation::is_airway_type<Target>::value);
+        using Precision = typename ventilation::precision<Target>::type;
+        public:
+            explicit Trajectory(std::vector<Target> table)
+                : table_(std::move(table))
+                , index_(0)
+            {
+                assert(!table_.empty());
+            }
+
+            static Trajectory
+            square(const Target& low
+                , const Target& high
+                , const Time<Precision>& breath
+                , const Time<Precision>& period
+                , Precision inspiration) {
+                std::vector<Target> table(steps(breath, period));
+                std::size_t edge = boundary(table.size(), inspiration);
+                for (std::size_t i = 0; i < table.size(); i++) {
+                    table[i] = i < edge ? high : low;
+                }
+                return Trajectory(std::move(table));
+            }
+
+            static Trajectory
+            ramp(const Target& low
+                , const Target& peak
+                , const Time<Precision>& breath
+                , const Time<Precision>& period
+                , Precision inspiration) {
+                std::vector<Target> table(steps(breath, period));
+                std::size_t edge = boundary(table.size(), inspiration);
+                for (std::size_t i = 0; i < table.size(); i++) {
+                    Precision fraction  = Precision(i) / Precision(edge);
+                    table[i]            = i < edge ? peak + (low - peak) * fraction : low;
+                }
+                return Trajectory(std::move(table));
+            }
+
+            static Trajectory
+            sine(const Target& low
+                , const Target& high
+                , const Time<Precision>& breath
+                , const Time<Precision>& period) {
+                std::vector<Target> table(steps(breath, period));
+                Target middle       = (low + high) * Precision(0.5);
+                Target amplitude    = (high - low) * Precision(0.5);
+                for (std::size_t i = 0; i < table.size(); i++) {
+                    Precision phase = Precision(2) * std::numbers::pi_v<Precision> * Precision(i) / Precision(table.size());
+                    table[i]        = middle + amplitude * std::sin(phase);
+                }
+                return Trajectory(std::move(table));
+            }
+
+            static Trajectory
+            piecewise(std::span<const std::pair<Time<Precision>, Target>> points
+                , const Time<Precision>& breath
+                , const Time<Precision>& period) {
+                assert(!points.empty());
+                std::vector<Target> table(steps(breath, period));
+                std::size_t segment = 0;
+                for (std::size_t i = 0; i < table.size(); i++) {
+                    Precision t = Precision(i) * period.count();
+                    while (segment + 1 < points.size() && points[segment + 1].first.count() <= t) {
+                        segment++;
+                    }
+
+                    const auto& [start, from] = points[segment];
+                    if (segment + 1 == points.size() || t < start.count()) {
+                        table[i] = from;
+                        continue;
+                    }
+
+                    const auto& [end, to] = points[segment + 1];
+                    Precision fraction  = (t - start.count()) / (end.count() - start.count());
+                    table[i]            = from + (to - from) * fraction;
+                }
+                return Trajectory(std::move(table));
+            }
+
+            const Target&
+            operator()() noexcept {
+                const Target& target    = table_[index_];
+                index_                  = index_ + 1 == table_.size() ? 0 : index_ + 1;
+                return target;
+            }
+
+            void
+            reset() noexcept {
+                index_ = 0;
+            }
+
+            std::size_t
+            size() const noexcept {
+                return table_.size();
+            }
+
+            std::span<const Target>
+            table() const noexcept {
+                return table_;
+            }
+        private:
+            static std::size_t
+            steps(const Time<Precision>& breath, const Time<Precision>& period) {
+                std::size_t count = static_cast<std::size_t>(std::lround(breath.count() / period.count()));
+                return count == 0 ? 1 : count;
+            }
+
+            static std::size_t
+            boundary(std::size_t size, Precision inspiration) {
+                Precision edge = std::round(Precision(size) * inspiration);
+                return edge < Precision(1) ? 1 : (edge > Precision(size) ? size : static_cast<std::size_t>(edge));
+            }
+
+            std::vector<Target> table_;
+            std::size_t         index_;
+    };
+} // namespace control
+
+#endif // CONTROL_TRAJECTORY_HPP__
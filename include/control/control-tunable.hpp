@@ -0,0 +1,46 @@
+#ifndef CONTROL_TUNABLE_HPP__
+#define CONTROL_TUNABLE_HPP__
+
+#include <ventilation/ventilation.hpp>
+
+#include "control-parameters.hpp"
+#include "control-process.hpp"
+#include "control-ring.hpp"
+#include "control-value.hpp"
+
+namespace control {
+    template <typename Target, typename Controller>
+    class Tunable {
+        static_assert(ventilation::is_airway_type<Target>::value);
+        using Precision = typename ventilation::precision<Target>::type;
+        public:
+            explicit Tunable(const Controller& controller)
+                : controller_(controller)
+                , pending_()
+            {}
+
+            void
+            publish(const Parameters<Target>& parameters) noexcept {
+                pending_.publish(parameters);
+            }
+
+            control::Value<Precision>
+            operator()(const control::Process<Target>& current) {
+                Parameters<Target> parameters;
+                if (pending_.poll(parameters)) {
+                    controller_.retune(parameters);
+                }
+                return control::Value<Precision>(controller_(current));
+            }
+
+            Controller&
+            get() noexcept {
+                return controller_;
+            }
+        private:
+            Controller                          controller_;
+            control::Latest<Parameters<Target>> pending_;
+    };
+} // namespace control
+
+#endif // CONTROL_TUNABLE_HPP__
@@ -0,0 +1,173 @@
+#ifndef CONTROL_TUNE_HPP__
+#define CONTROL_TUNE_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <optional>
+#include <ventilation/ventilation.hpp>
+
+#include "control-gain.hpp"
+#include "control-parameters.hpp"
+#include "control-pool.hpp"
+#include "control-time.hpp"
+
+namespace control {
+    template <typename Precision>
+    struct Ultimate {
+        Precision                   gain;
+        control::Time<Precision>    period;
+    };
+
+    template <typename Target, typename Plant>
+    std::optional<Ultimate<typename ventilation::precision<Target>::type>>
+    relay(Plant&& plant
+        , const Target& bias
+        , const Target& setpoint
+        , const Target& amplitude
+        , const Target& hysteresis
+        , const control::Time<typename ventilation::precision<Target>::type>& period
+        , std::size_t steps
+        , std::size_t cycles = 4) {
+        static_assert(ventilation::is_airway_type<Target>::value);
+        using Precision = typename ventilation::precision<Target>::type;
+
+        const Precision d   = static_cast<Precision>(amplitude);
+        const Precision h   = static_cast<Precision>(hysteresis);
+        const Precision r   = static_cast<Precision>(setpoint);
+
+        bool high           = true;
+        Precision y         = r;
+        Precision peak      = r;
+        Precision trough    = r;
+        std::size_t rising  = 0;
+        std::size_t edges   = 0;
+        std::size_t settled = 0;
+        Precision last      = Precision();
+        Precision length    = Precision();
+        Precision swing     = Precision();
+        for (std::size_t i = 0; i < steps && settled < cycles; i++) {
+            Precision error = r - y;
+            if (high && error < -h) {
+                high = false;
+            } else if (!high && error > h) {
+                high = true;
+                if (edges > 0) {
+                    Precision cycle = Precision(i - rising);
+                    bool steady     = std::abs(cycle - last) <= Precision(0.01) * cycle;
+                    settled         = steady ? settled + 1 : 0;
+                    length          = steady ? length + cycle : Precision();
+                    swing           = steady ? swing + (peak - trough) * Precision(0.5) : Precision();
+                    last            = cycle;
+                }
+                edges++;
+                rising  = i;
+                peak    = y;
+                trough  = y;
+            }
+
+            Target command  = high ? bias + amplitude : bias - amplitude;
+            y               = static_cast<Precision>(plant(command, period));
+            peak            = std::max(peak, y);
+            trough          = std::min(trough, y);
+        }
+
+        if (settled < cycles) {
+            return std::nullopt;
+        }
+
+        Precision a = swing / Precision(cycles);
+        if (!(a > h)) {
+            return std::nullopt;
+        }
+
+        return Ultimate<Precision>{
+            Precision(4) * d / (std::numbers::pi_v<Precision> * std::sqrt(a * a - h * h)),
+            control::Time<Precision>(length / Precision(cycles) * period.count()),
+        };
+    }
+
+    template <typename Target>
+    Parameters<Target>
+    ziegler_nichols(const Ultimate<typename ventilation::precision<Target>::type>& ultimate, const Target& target) {
+        static_assert(ventilation::is_airway_type<Target>::value);
+        using Precision = typename ventilation::precision<Target>::type;
+
+        Precision ku = ultimate.gain;
+        Precision tu = ultimate.period.count();
+        return Parameters<Target>{
+            Gain<Target>(Precision(0.6) * ku),
+            Gain<Target>(Precision(1.2) * ku / tu),
+            Gain<Target>(Precision(0.075) * ku * tu),
+            target,
+        };
+    }
+
+    template <typename Target, typename Cost>
+    Parameters<Target>
+    refine(Pool& pool
+        , const Parameters<Target>& initial
+        , const Parameters<Target>& scale
+        , Cost&& cost
+        , typename ventilation::precision<Target>::type step = 0.5
+        , typename ventilation::precision<Target>::type tolerance = 0.01
+        , std::size_t iterations = 100) {
+        static_assert(ventilation::is_airway_type<Target>::value);
+        using Precision = typename ventilation::precision<Target>::type;
+        constexpr std::size_t POLL = 6;
+
+        Parameters<Target> best = initial;
+        Precision score         = cost(best);
+        std::array<Parameters<Target>, POLL> candidates;
+        std::array<Precision, POLL> scores;
+        std::array<bool, POLL> active;
+        const std::array<Precision, 3> increments{
+            static_cast<Precision>(scale.proportional),
+            static_cast<Precision>(scale.integral),
+            static_cast<Precision>(scale.differential),
+        };
+        for (std::size_t iteration = 0; iteration < iterations && step > tolerance; iteration++) {
+            const Precision up      = std::exp(step);
+            const Precision down    = Precision(1) / up;
+            const std::array<Precision, 3> gains{
+                static_cast<Precision>(best.proportional),
+                static_cast<Precision>(best.integral),
+                static_cast<Precision>(best.differential),
+            };
+            for (std::size_t i = 0; i < POLL; i++) {
+                std::array<Precision, 3> moved = gains;
+                Precision& gain                = moved[i / 2];
+                if (gain == Precision()) {
+                    gain = i % 2 == 0 ? increments[i / 2] * step : Precision();
+                } else {
+                    gain *= i % 2 == 0 ? up : down;
+                }
+                active[i]     = gain != gains[i / 2];
+                candidates[i] = Parameters<Target>{
+                    Gain<Target>(moved[0]),
+                    Gain<Target>(moved[1]),
+                    Gain<Target>(moved[2]),
+                    best.target,
+                };
+            }
+
+            pool(POLL, [&](std::size_t index, std::size_t) {
+                scores[index] = active[index] ? cost(candidates[index]) : std::numeric_limits<Precision>::infinity();
+            });
+
+            std::size_t winner = static_cast<std::size_t>(std::min_element(scores.begin(), scores.end()) - scores.begin());
+            if (scores[winner] < score) {
+                best    = candidates[winner];
+                score   = scores[winner];
+            } else {
+                step   *= Precision(0.5);
+            }
+        }
+        return best;
+    }
+} // namespace control
+
+#endif // CONTROL_TUNE_HPP__
@@ -3,13 +3,38 @@
 
 #include <variant>
 
+#include "control-bank.hpp"
+#include "control-fixed.hpp"
 #include "control-gain.hpp"
+#include "control-instrument.hpp"
+#include "control-parameters.hpp"
 #include "control-process.hpp"
+#include "control-ring.hpp"
+#include "control-saturation.hpp"
 #include "control-time.hpp"
 
 #include "control-proportional.hpp"
 #include "control-integral.hpp"
 #include "control-differential.hpp"
+#include "control-filtered.hpp"
+#include "control-pid.hpp"
+#include "control-periodic.hpp"
+#include "control-incremental.hpp"
+#include "control-pipeline.hpp"
+#include "control-cascade.hpp"
+#include "control-schedule.hpp"
+#include "control-tunable.hpp"
+
+#ifndef CONTROL_FREESTANDING
+#include "control-heap.hpp"
+#include "control-io.hpp"
+#include "control-metrics.hpp"
+#include "control-plant.hpp"
+#include "control-pool.hpp"
+#include "control-scheduler.hpp"
+#include "control-trajectory.hpp"
+#include "control-tune.hpp"
+#endif
 
 namespace control {
     template <typename Target>
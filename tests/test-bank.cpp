@@ -0,0 +1,568 @@
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+#include <control/control.hpp>
+
+namespace rc {
+    template<typename Precision>
+    struct Arbitrary<ventilation::Flow<Precision>> {
+        static Gen<ventilation::Flow<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Flow<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::Pressure<Precision>> {
+        static Gen<ventilation::Pressure<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Pressure<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::PEEP<Precision>> {
+        static Gen<ventilation::PEEP<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::PEEP<Precision>>(
+                    gen::arbitrary<ventilation::Pressure<Precision>>()
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::Volume<Precision>> {
+        static Gen<ventilation::Volume<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Volume<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+} // namespace rc
+
+namespace f32 {
+    using Flow      = ventilation::Flow<float>;
+    using Pressure  = ventilation::Pressure<float>;
+    using Volume    = ventilation::Volume<float>;
+    using Time      = control::Time<float>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Fixed, Flow, (const std::array<Flow, 4>& xs)) {
+        Time duration = 1ms;
+        control::Bank<Flow, 4>          bank;
+        std::vector<control::PID<Flow>> pids;
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            float scale = static_cast<float>(c + 1);
+            control::Gain<Flow> kp(0.5f * scale);
+            control::Gain<Flow> ki(5.0e1f * scale);
+            control::Gain<Flow> kd(3e-4f * scale);
+            bank.assign(c, kp, ki, kd, xs[c]);
+            pids.emplace_back(kp, ki, kd, xs[c]);
+        }
+
+        std::array<Flow, 4>                          measurements{};
+        std::array<control::Value<float>, 4> output{};
+        for (std::size_t i = 0; i < 100; i++) {
+            bank(measurements, duration, output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                control::Process<Flow> process{measurements[c], duration};
+                Flow expected = pids[c](process);
+                Flow actual   = output[c];
+
+                RC_ASSERT(expected == actual);
+                measurements[c] += 1e-3f * actual;
+            }
+        }
+    }
+
+    RC_GTEST_PROP(Dynamic, Flow, (const std::vector<Flow>& xs)) {
+        Time duration = 1ms;
+        control::Bank<Flow>             bank(xs.size());
+        std::vector<control::PID<Flow>> pids;
+        control::Gain<Flow> kp(0.5f);
+        control::Gain<Flow> ki(5.0e1f);
+        control::Gain<Flow> kd(3e-4f);
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            bank.assign(c, kp, ki, kd, xs[c]);
+            pids.emplace_back(kp, ki, kd, xs[c]);
+        }
+
+        std::vector<Flow>                       measurements(xs.size());
+        std::vector<control::Value<float>> output(xs.size());
+        for (std::size_t i = 0; i < 100; i++) {
+            bank(measurements, duration, output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                control::Process<Flow> process{measurements[c], duration};
+                Flow expected = pids[c](process);
+                Flow actual   = output[c];
+
+                RC_ASSERT(expected == actual);
+                measurements[c] += 1e-3f * actual;
+            }
+        }
+    }
+
+    RC_GTEST_PROP(Fixed, Pressure, (const std::array<Pressure, 4>& xs)) {
+        Time duration = 1ms;
+        control::Bank<Pressure, 4>          bank;
+        std::vector<control::PID<Pressure>> pids;
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            float scale = static_cast<float>(c + 1);
+            control::Gain<Pressure> kp(0.5f * scale);
+            control::Gain<Pressure> ki(5.0e1f * scale);
+            control::Gain<Pressure> kd(3e-4f * scale);
+            bank.assign(c, kp, ki, kd, xs[c]);
+            pids.emplace_back(kp, ki, kd, xs[c]);
+        }
+
+        std::array<Pressure, 4>                          measurements{};
+        std::array<control::Value<float>, 4> output{};
+        for (std::size_t i = 0; i < 100; i++) {
+            bank(measurements, duration, output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                control::Process<Pressure> process{measurements[c], duration};
+                Pressure expected = pids[c](process);
+                Pressure actual   = output[c];
+
+                RC_ASSERT(expected == actual);
+                measurements[c] += 1e-3f * actual;
+            }
+        }
+    }
+
+    RC_GTEST_PROP(Dynamic, Pressure, (const std::vector<Pressure>& xs)) {
+        Time duration = 1ms;
+        control::Bank<Pressure>             bank(xs.size());
+        std::vector<control::PID<Pressure>> pids;
+        control::Gain<Pressure> kp(0.5f);
+        control::Gain<Pressure> ki(5.0e1f);
+        control::Gain<Pressure> kd(3e-4f);
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            bank.assign(c, kp, ki, kd, xs[c]);
+            pids.emplace_back(kp, ki, kd, xs[c]);
+        }
+
+        std::vector<Pressure>                       measurements(xs.size());
+        std::vector<control::Value<float>> output(xs.size());
+        for (std::size_t i = 0; i < 100; i++) {
+            bank(measurements, duration, output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                control::Process<Pressure> process{measurements[c], duration};
+                Pressure expected = pids[c](process);
+                Pressure actual   = output[c];
+
+                RC_ASSERT(expected == actual);
+                measurements[c] += 1e-3f * actual;
+            }
+        }
+    }
+
+    RC_GTEST_PROP(Fixed, Volume, (const std::array<Volume, 4>& xs)) {
+        Time duration = 1ms;
+        control::Bank<Volume, 4>          bank;
+        std::vector<control::PID<Volume>> pids;
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            float scale = static_cast<float>(c + 1);
+            control::Gain<Volume> kp(0.5f * scale);
+            control::Gain<Volume> ki(5.0e1f * scale);
+            control::Gain<Volume> kd(3e-4f * scale);
+            bank.assign(c, kp, ki, kd, xs[c]);
+            pids.emplace_back(kp, ki, kd, xs[c]);
+        }
+
+        std::array<Volume, 4>                          measurements{};
+        std::array<control::Value<float>, 4> output{};
+        for (std::size_t i = 0; i < 100; i++) {
+            bank(measurements, duration, output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                control::Process<Volume> process{measurements[c], duration};
+                Volume expected = pids[c](process);
+                Volume actual   = output[c];
+
+                RC_ASSERT(expected == actual);
+                measurements[c] += 1e-3f * actual;
+            }
+        }
+    }
+
+    RC_GTEST_PROP(Dynamic, Volume, (const std::vector<Volume>& xs)) {
+        Time duration = 1ms;
+        control::Bank<Volume>             bank(xs.size());
+        std::vector<control::PID<Volume>> pids;
+        control::Gain<Volume> kp(0.5f);
+        control::Gain<Volume> ki(5.0e1f);
+        control::Gain<Volume> kd(3e-4f);
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            bank.assign(c, kp, ki, kd, xs[c]);
+            pids.emplace_back(kp, ki, kd, xs[c]);
+        }
+
+        std::vector<Volume>                       measurements(xs.size());
+        std::vector<control::Value<float>> output(xs.size());
+        for (std::size_t i = 0; i < 100; i++) {
+            bank(measurements, duration, output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                control::Process<Volume> process{measurements[c], duration};
+                Volume expected = pids[c](process);
+                Volume actual   = output[c];
+
+                RC_ASSERT(expected == actual);
+                measurements[c] += 1e-3f * actual;
+            }
+        }
+    }
+} // namespace f32
+namespace f64 {
+    using Flow      = ventilation::Flow<double>;
+    using Pressure  = ventilation::Pressure<double>;
+    using Volume    = ventilation::Volume<double>;
+    using Time      = control::Time<double>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Fixed, Flow, (const std::array<Flow, 4>& xs)) {
+        Time duration = 1ms;
+        control::Bank<Flow, 4>          bank;
+        std::vector<control::PID<Flow>> pids;
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            double scale = static_cast<double>(c + 1);
+            control::Gain<Flow> kp(0.5 * scale);
+            control::Gain<Flow> ki(5.0e1 * scale);
+            control::Gain<Flow> kd(3e-4 * scale);
+            bank.assign(c, kp, ki, kd, xs[c]);
+            pids.emplace_back(kp, ki, kd, xs[c]);
+        }
+
+        std::array<Flow, 4>                          measurements{};
+        std::array<control::Value<double>, 4> output{};
+        for (std::size_t i = 0; i < 100; i++) {
+            bank(measurements, duration, output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                control::Process<Flow> process{measurements[c], duration};
+                Flow expected = pids[c](process);
+                Flow actual   = output[c];
+
+                RC_ASSERT(expected == actual);
+                measurements[c] += 1e-3 * actual;
+            }
+        }
+    }
+
+    RC_GTEST_PROP(Dynamic, Flow, (const std::vector<Flow>& xs)) {
+        Time duration = 1ms;
+        control::Bank<Flow>             bank(xs.size());
+        std::vector<control::PID<Flow>> pids;
+        control::Gain<Flow> kp(0.5);
+        control::Gain<Flow> ki(5.0e1);
+        control::Gain<Flow> kd(3e-4);
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            bank.assign(c, kp, ki, kd, xs[c]);
+            pids.emplace_back(kp, ki, kd, xs[c]);
+        }
+
+        std::vector<Flow>                       measurements(xs.size());
+        std::vector<control::Value<double>> output(xs.size());
+        for (std::size_t i = 0; i < 100; i++) {
+            bank(measurements, duration, output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                control::Process<Flow> process{measurements[c], duration};
+                Flow expected = pids[c](process);
+                Flow actual   = output[c];
+
+                RC_ASSERT(expected == actual);
+                measurements[c] += 1e-3 * actual;
+            }
+        }
+    }
+
+    RC_GTEST_PROP(Fixed, Pressure, (const std::array<Pressure, 4>& xs)) {
+        Time duration = 1ms;
+        control::Bank<Pressure, 4>          bank;
+        std::vector<control::PID<Pressure>> pids;
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            double scale = static_cast<double>(c + 1);
+            control::Gain<Pressure> kp(0.5 * scale);
+            control::Gain<Pressure> ki(5.0e1 * scale);
+            control::Gain<Pressure> kd(3e-4 * scale);
+            bank.assign(c, kp, ki, kd, xs[c]);
+            pids.emplace_back(kp, ki, kd, xs[c]);
+        }
+
+        std::array<Pressure, 4>                          measurements{};
+        std::array<control::Value<double>, 4> output{};
+        for (std::size_t i = 0; i < 100; i++) {
+            bank(measurements, duration, output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                control::Process<Pressure> process{measurements[c], duration};
+                Pressure expected = pids[c](process);
+                Pressure actual   = output[c];
+
+                RC_ASSERT(expected == actual);
+                measurements[c] += 1e-3 * actual;
+            }
+        }
+    }
+
+    RC_GTEST_PROP(Dynamic, Pressure, (const std::vector<Pressure>& xs)) {
+        Time duration = 1ms;
+        control::Bank<Pressure>             bank(xs.size());
+        std::vector<control::PID<Pressure>> pids;
+        control::Gain<Pressure> kp(0.5);
+        control::Gain<Pressure> ki(5.0e1);
+        control::Gain<Pressure> kd(3e-4);
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            bank.assign(c, kp, ki, kd, xs[c]);
+            pids.emplace_back(kp, ki, kd, xs[c]);
+        }
+
+        std::vector<Pressure>                       measurements(xs.size());
+        std::vector<control::Value<double>> output(xs.size());
+        for (std::size_t i = 0; i < 100; i++) {
+            bank(measurements, duration, output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                control::Process<Pressure> process{measurements[c], duration};
+                Pressure expected = pids[c](process);
+                Pressure actual   = output[c];
+
+                RC_ASSERT(expected == actual);
+                measurements[c] += 1e-3 * actual;
+            }
+        }
+    }
+
+    RC_GTEST_PROP(Fixed, Volume, (const std::array<Volume, 4>& xs)) {
+        Time duration = 1ms;
+        control::Bank<Volume, 4>          bank;
+        std::vector<control::PID<Volume>> pids;
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            double scale = static_cast<double>(c + 1);
+            control::Gain<Volume> kp(0.5 * scale);
+            control::Gain<Volume> ki(5.0e1 * scale);
+            control::Gain<Volume> kd(3e-4 * scale);
+            bank.assign(c, kp, ki, kd, xs[c]);
+            pids.emplace_back(kp, ki, kd, xs[c]);
+        }
+
+        std::array<Volume, 4>                          measurements{};
+        std::array<control::Value<double>, 4> output{};
+        for (std::size_t i = 0; i < 100; i++) {
+            bank(measurements, duration, output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                control::Process<Volume> process{measurements[c], duration};
+                Volume expected = pids[c](process);
+                Volume actual   = output[c];
+
+                RC_ASSERT(expected == actual);
+                measurements[c] += 1e-3 * actual;
+            }
+        }
+    }
+
+    RC_GTEST_PROP(Dynamic, Volume, (const std::vector<Volume>& xs)) {
+        Time duration = 1ms;
+        control::Bank<Volume>             bank(xs.size());
+        std::vector<control::PID<Volume>> pids;
+        control::Gain<Volume> kp(0.5);
+        control::Gain<Volume> ki(5.0e1);
+        control::Gain<Volume> kd(3e-4);
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            bank.assign(c, kp, ki, kd, xs[c]);
+            pids.emplace_back(kp, ki, kd, xs[c]);
+        }
+
+        std::vector<Volume>                       measurements(xs.size());
+        std::vector<control::Value<double>> output(xs.size());
+        for (std::size_t i = 0; i < 100; i++) {
+            bank(measurements, duration, output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                control::Process<Volume> process{measurements[c], duration};
+                Volume expected = pids[c](process);
+                Volume actual   = output[c];
+
+                RC_ASSERT(expected == actual);
+                measurements[c] += 1e-3 * actual;
+            }
+        }
+    }
+} // namespace f64
+namespace f128 {
+    using Flow      = ventilation::Flow<long double>;
+    using Pressure  = ventilation::Pressure<long double>;
+    using Volume    = ventilation::Volume<long double>;
+    using Time      = control::Time<long double>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Fixed, Flow, (const std::array<Flow, 4>& xs)) {
+        Time duration = 1ms;
+        control::Bank<Flow, 4>          bank;
+        std::vector<control::PID<Flow>> pids;
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            long double scale = static_cast<long double>(c + 1);
+            control::Gain<Flow> kp(0.5L * scale);
+            control::Gain<Flow> ki(5.0e1L * scale);
+            control::Gain<Flow> kd(3e-4L * scale);
+            bank.assign(c, kp, ki, kd, xs[c]);
+            pids.emplace_back(kp, ki, kd, xs[c]);
+        }
+
+        std::array<Flow, 4>                          measurements{};
+        std::array<control::Value<long double>, 4> output{};
+        for (std::size_t i = 0; i < 100; i++) {
+            bank(measurements, duration, output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                control::Process<Flow> process{measurements[c], duration};
+                Flow expected = pids[c](process);
+                Flow actual   = output[c];
+
+                RC_ASSERT(expected == actual);
+                measurements[c] += 1e-3L * actual;
+            }
+        }
+    }
+
+    RC_GTEST_PROP(Dynamic, Flow, (const std::vector<Flow>& xs)) {
+        Time duration = 1ms;
+        control::Bank<Flow>             bank(xs.size());
+        std::vector<control::PID<Flow>> pids;
+        control::Gain<Flow> kp(0.5L);
+        control::Gain<Flow> ki(5.0e1L);
+        control::Gain<Flow> kd(3e-4L);
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            bank.assign(c, kp, ki, kd, xs[c]);
+            pids.emplace_back(kp, ki, kd, xs[c]);
+        }
+
+        std::vector<Flow>                       measurements(xs.size());
+        std::vector<control::Value<long double>> output(xs.size());
+        for (std::size_t i = 0; i < 100; i++) {
+            bank(measurements, duration, output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                control::Process<Flow> process{measurements[c], duration};
+                Flow expected = pids[c](process);
+                Flow actual   = output[c];
+
+                RC_ASSERT(expected == actual);
+                measurements[c] += 1e-3L * actual;
+            }
+        }
+    }
+
+    RC_GTEST_PROP(Fixed, Pressure, (const std::array<Pressure, 4>& xs)) {
+        Time duration = 1ms;
+        control::Bank<Pressure, 4>          bank;
+        std::vector<control::PID<Pressure>> pids;
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            long double scale = static_cast<long double>(c + 1);
+            control::Gain<Pressure> kp(0.5L * scale);
+            control::Gain<Pressure> ki(5.0e1L * scale);
+            control::Gain<Pressure> kd(3e-4L * scale);
+            bank.assign(c, kp, ki, kd, xs[c]);
+            pids.emplace_back(kp, ki, kd, xs[c]);
+        }
+
+        std::array<Pressure, 4>                          measurements{};
+        std::array<control::Value<long double>, 4> output{};
+        for (std::size_t i = 0; i < 100; i++) {
+            bank(measurements, duration, output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                control::Process<Pressure> process{measurements[c], duration};
+                Pressure expected = pids[c](process);
+                Pressure actual   = output[c];
+
+                RC_ASSERT(expected == actual);
+                measurements[c] += 1e-3L * actual;
+            }
+        }
+    }
+
+    RC_GTEST_PROP(Dynamic, Pressure, (const std::vector<Pressure>& xs)) {
+        Time duration = 1ms;
+        control::Bank<Pressure>             bank(xs.size());
+        std::vector<control::PID<Pressure>> pids;
+        control::Gain<Pressure> kp(0.5L);
+        control::Gain<Pressure> ki(5.0e1L);
+        control::Gain<Pressure> kd(3e-4L);
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            bank.assign(c, kp, ki, kd, xs[c]);
+            pids.emplace_back(kp, ki, kd, xs[c]);
+        }
+
+        std::vector<Pressure>                       measurements(xs.size());
+        std::vector<control::Value<long double>> output(xs.size());
+        for (std::size_t i = 0; i < 100; i++) {
+            bank(measurements, duration, output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                control::Process<Pressure> process{measurements[c], duration};
+                Pressure expected = pids[c](process);
+                Pressure actual   = output[c];
+
+                RC_ASSERT(expected == actual);
+                measurements[c] += 1e-3L * actual;
+            }
+        }
+    }
+
+    RC_GTEST_PROP(Fixed, Volume, (const std::array<Volume, 4>& xs)) {
+        Time duration = 1ms;
+        control::Bank<Volume, 4>          bank;
+        std::vector<control::PID<Volume>> pids;
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            long double scale = static_cast<long double>(c + 1);
+            control::Gain<Volume> kp(0.5L * scale);
+            control::Gain<Volume> ki(5.0e1L * scale);
+            control::Gain<Volume> kd(3e-4L * scale);
+            bank.assign(c, kp, ki, kd, xs[c]);
+            pids.emplace_back(kp, ki, kd, xs[c]);
+        }
+
+        std::array<Volume, 4>                          measurements{};
+        std::array<control::Value<long double>, 4> output{};
+        for (std::size_t i = 0; i < 100; i++) {
+            bank(measurements, duration, output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                control::Process<Volume> process{measurements[c], duration};
+                Volume expected = pids[c](process);
+                Volume actual   = output[c];
+
+                RC_ASSERT(expected == actual);
+                measurements[c] += 1e-3L * actual;
+            }
+        }
+    }
+
+    RC_GTEST_PROP(Dynamic, Volume, (const std::vector<Volume>& xs)) {
+        Time duration = 1ms;
+        control::Bank<Volume>             bank(xs.size());
+        std::vector<control::PID<Volume>> pids;
+        control::Gain<Volume> kp(0.5L);
+        control::Gain<Volume> ki(5.0e1L);
+        control::Gain<Volume> kd(3e-4L);
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            bank.assign(c, kp, ki, kd, xs[c]);
+            pids.emplace_back(kp, ki, kd, xs[c]);
+        }
+
+        std::vector<Volume>                       measurements(xs.size());
+        std::vector<control::Value<long double>> output(xs.size());
+        for (std::size_t i = 0; i < 100; i++) {
+            bank(measurements, duration, output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                control::Process<Volume> process{measurements[c], duration};
+                Volume expected = pids[c](process);
+                Volume actual   = output[c];
+
+                RC_ASSERT(expected == actual);
+                measurements[c] += 1e-3L * actual;
+            }
+        }
+    }
+} // namespace f128
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+#include <control/control.hpp>
+
+namespace rc {
+    template<typename Precision>
+    struct Arbitrary<ventilation::Pressure<Precision>> {
+        static Gen<ventilation::Pressure<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Pressure<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+} // namespace rc
+
+namespace f32 {
+    using Flow      = ventilation::Flow<float>;
+    using Pressure  = ventilation::Pressure<float>;
+    using Time      = control::Time<float>;
+    using namespace std::chrono_literals;
+
+    class Counting {
+        public:
+            control::Value<float>
+            operator()(const control::Process<Pressure>& current) {
+                calls_++;
+                last_ = current.duration;
+                return control::Value<float>(Pressure(static_cast<float>(calls_)));
+            }
+
+            std::size_t calls_  = 0;
+            Time        last_   = Time(0s);
+    };
+
+    RC_GTEST_PROP(Cascade, Unit, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::PID<Pressure>      outer(control::Gain<Pressure>(0.5f), control::Gain<Pressure>(5.0e1f), control::Gain<Pressure>(3e-4f), xs);
+        control::Proportional<Flow> inner(control::Gain<Flow>(2.0f), Flow(0.0f));
+        control::Cascade<Pressure, Flow, control::PID<Pressure>, control::Proportional<Flow>> cascade(outer, inner, 1, Flow(0.0f));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale     = static_cast<float>(i) / 100.0f;
+            Pressure pressure = scale * xs;
+            Flow flow       = Flow(static_cast<float>(pressure) * 0.5f);
+
+            Flow target     = outer(control::Process<Pressure>{pressure, duration});
+            Flow expected   = inner(control::Process<Flow>{flow, duration}, target);
+            Flow actual     = cascade(pressure, control::Process<Flow>{flow, duration});
+
+            RC_ASSERT(target == cascade.target());
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    TEST(Cascade, Rate) {
+        control::Proportional<Flow> inner(control::Gain<Flow>(1.0f), Flow(0.0f));
+        control::Cascade<Pressure, Flow, Counting, control::Proportional<Flow>> cascade(Counting(), inner, 5, Flow(0.0f));
+
+        for (std::size_t i = 0; i < 23; i++) {
+            Time duration = i < 10 ? Time(1ms) : Time(2ms);
+            cascade(Pressure(0.0f), control::Process<Flow>{Flow(0.0f), duration});
+            EXPECT_EQ(i / 5 + 1, cascade.outer().calls_);
+            EXPECT_EQ(Flow(static_cast<float>(i / 5 + 1)), cascade.target());
+        }
+        EXPECT_FLOAT_EQ(10e-3f, cascade.outer().last_.count());
+    }
+
+    TEST(Cascade, Elapsed) {
+        control::Proportional<Flow> inner(control::Gain<Flow>(1.0f), Flow(0.0f));
+        control::Cascade<Pressure, Flow, Counting, control::Proportional<Flow>> cascade(Counting(), inner, 4, Flow(0.0f));
+
+        cascade(Pressure(0.0f), control::Process<Flow>{Flow(0.0f), Time(1ms)});
+        EXPECT_FLOAT_EQ(1e-3f, cascade.outer().last_.count());
+        for (std::size_t i = 0; i < 4; i++) {
+            cascade(Pressure(0.0f), control::Process<Flow>{Flow(0.0f), Time(i < 2 ? 1ms : 3ms)});
+        }
+        EXPECT_EQ(2u, cascade.outer().calls_);
+        EXPECT_FLOAT_EQ(8e-3f, cascade.outer().last_.count());
+    }
+
+    TEST(Cascade, First) {
+        control::Proportional<Flow> inner(control::Gain<Flow>(1.0f), Flow(0.0f));
+        control::Cascade<Pressure, Flow, Counting, control::Proportional<Flow>> cascade(Counting(), inner, 10, Flow(0.0f));
+
+        cascade(Pressure(0.0f), control::Process<Flow>{Flow(0.0f), Time(3ms)});
+        EXPECT_EQ(1u, cascade.outer().calls_);
+        EXPECT_FLOAT_EQ(3e-3f, cascade.outer().last_.count());
+        for (std::size_t i = 0; i < 9; i++) {
+            cascade(Pressure(0.0f), control::Process<Flow>{Flow(0.0f), Time(1ms)});
+        }
+        EXPECT_EQ(1u, cascade.outer().calls_);
+        cascade(Pressure(0.0f), control::Process<Flow>{Flow(0.0f), Time(1ms)});
+        EXPECT_EQ(2u, cascade.outer().calls_);
+        EXPECT_FLOAT_EQ(10e-3f, cascade.outer().last_.count());
+    }
+
+    TEST(Cascade, ClosedLoop) {
+        using Gain = control::Gain<Flow>;
+        control::PID<Pressure>      outer(control::Gain<Pressure>(2.0f), control::Gain<Pressure>(2.0f), control::Gain<Pressure>(0.0f), Pressure(20.0f));
+        control::PID<Flow>          inner(Gain(0.2f), Gain(2.0e1f), Gain(0.0f), Flow(0.0f));
+        control::Cascade<Pressure, Flow, control::PID<Pressure>, control::PID<Flow>> cascade(outer, inner, 10, Flow(0.0f));
+
+        float compliance    = 5.0e-2f;
+        float flow          = 0.0f;
+        float pressure      = 5.0f;
+        for (std::size_t i = 0; i < 10000; i++) {
+            Time duration = 1ms;
+            float command = static_cast<float>(Flow(cascade(Pressure(pressure), control::Process<Flow>{Flow(flow), duration})));
+            flow         += command;
+            pressure     += flow * duration.count() / compliance;
+        }
+        EXPECT_NEAR(20.0f, pressure, 0.1f);
+    }
+} // namespace f32
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <control/control.hpp>
+#include <array>
+
+namespace f32 {
+    using Pressure  = ventilation::Pressure<float>;
+    using Process   = control::Process<Pressure>;
+    using Gain      = control::Gain<Pressure>;
+    using Time      = control::Time<float>;
+
+    constexpr std::size_t STEPS = 200;
+
+    constexpr std::array<Pressure, STEPS>
+    response(const Pressure& target) {
+        control::PID<Pressure> pid(Gain(0.5f), Gain(5.0e1f), Gain(3e-4f), target);
+        std::array<Pressure, STEPS> result{};
+        Process process{Pressure(0.0f), Time(1e-3f)};
+        for (Pressure& sample : result) {
+            process.measurement    += pid(process);
+            sample                  = process.measurement;
+        }
+        return result;
+    }
+
+    constexpr std::array<Pressure, STEPS> STEP = response(Pressure(1.0f));
+
+    constexpr bool
+    settled(const std::array<Pressure, STEPS>& samples, float target, float band) {
+        float last = static_cast<float>(samples[STEPS - 1]) - target;
+        return last < band && -last < band;
+    }
+
+    constexpr bool
+    bounded(const std::array<Pressure, STEPS>& samples, float limit) {
+        for (const Pressure& sample : samples) {
+            if (!(static_cast<float>(sample) < limit)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static_assert(settled(STEP, 1.0f, 1e-3f));
+    static_assert(bounded(STEP, 1.2f));
+
+    constexpr float
+    terms() {
+        control::Proportional<Pressure> proportional(Gain(2.0f), Pressure(3.0f));
+        control::Integral<Pressure>     integral(Gain(1.0f), Pressure(3.0f));
+        control::Differential<Pressure> differential(Gain(1.0f), Pressure(3.0f));
+        Process process{Pressure(1.0f), Time(0.5f)};
+
+        return static_cast<float>(Pressure(proportional(process)))
+            + static_cast<float>(Pressure(integral(process)))
+            + static_cast<float>(Pressure(differential(process)));
+    }
+
+    static_assert(terms() == 4.0f + 1.0f + 4.0f);
+
+    constexpr control::Saturation<Pressure> LIMITS(Pressure(-1.0f), Pressure(1.0f));
+    static_assert(static_cast<float>(LIMITS(Pressure(5.0f))) == 1.0f);
+    static_assert(static_cast<float>((LIMITS / Gain(-2.0f)).upper()) == 0.5f);
+
+    constexpr std::array<control::Breakpoint<Pressure>, 2> TABLE{
+        control::Breakpoint<Pressure>{Gain(1.0f), Gain(2.0f), Gain(3.0f)},
+        control::Breakpoint<Pressure>{Gain(3.0f), Gain(6.0f), Gain(9.0f)},
+    };
+    constexpr control::Schedule<Pressure, ventilation::Volume<float>, 2> SCHEDULE(
+        ventilation::Volume<float>(0.0f), ventilation::Volume<float>(1.0f), TABLE);
+    static_assert(static_cast<float>(SCHEDULE(ventilation::Volume<float>(0.5f)).integral) == 4.0f);
+
+    TEST(Constexpr, Runtime) {
+        std::array<Pressure, STEPS> runtime = response(Pressure(1.0f));
+        for (std::size_t i = 0; i < STEPS; i++) {
+            EXPECT_EQ(static_cast<float>(STEP[i]), static_cast<float>(runtime[i]));
+        }
+    }
+} // namespace f32
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
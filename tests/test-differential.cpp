@@ -143,6 +143,78 @@ namespace f32 {
             RC_ASSERT(expected == actual);
         }
     }
+
+    RC_GTEST_PROP(Batch, Flow, (const Flow& xs)) {
+        control::Gain<Flow>         gain(0.5f);
+        control::Differential<Flow> batched(gain, xs);
+        control::Differential<Flow> single(gain, xs);
+
+        std::vector<control::Process<Flow>> processes;
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            processes.push_back({scale * xs, Time(1ms)});
+        }
+
+        std::vector<control::Value<float>> output(processes.size());
+        std::span<const control::Process<Flow>> all(processes);
+        batched(all.first(50), std::span(output).first(50));
+        batched(all.subspan(50), std::span(output).subspan(50));
+
+        for (std::size_t i = 0; i < processes.size(); i++) {
+            Flow expected   = single(processes[i]);
+            Flow actual     = output[i];
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Batch, Pressure, (const Pressure& xs)) {
+        control::Gain<Pressure>         gain(0.5f);
+        control::Differential<Pressure> batched(gain, xs);
+        control::Differential<Pressure> single(gain, xs);
+
+        std::vector<control::Process<Pressure>> processes;
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            processes.push_back({scale * xs, Time(1ms)});
+        }
+
+        std::vector<control::Value<float>> output(processes.size());
+        std::span<const control::Process<Pressure>> all(processes);
+        batched(all.first(50), std::span(output).first(50));
+        batched(all.subspan(50), std::span(output).subspan(50));
+
+        for (std::size_t i = 0; i < processes.size(); i++) {
+            Pressure expected   = single(processes[i]);
+            Pressure actual     = output[i];
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Batch, Volume, (const Volume& xs)) {
+        control::Gain<Volume>         gain(0.5f);
+        control::Differential<Volume> batched(gain, xs);
+        control::Differential<Volume> single(gain, xs);
+
+        std::vector<control::Process<Volume>> processes;
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            processes.push_back({scale * xs, Time(1ms)});
+        }
+
+        std::vector<control::Value<float>> output(processes.size());
+        std::span<const control::Process<Volume>> all(processes);
+        batched(all.first(50), std::span(output).first(50));
+        batched(all.subspan(50), std::span(output).subspan(50));
+
+        for (std::size_t i = 0; i < processes.size(); i++) {
+            Volume expected   = single(processes[i]);
+            Volume actual     = output[i];
+
+            RC_ASSERT(expected == actual);
+        }
+    }
 } // namespace f32
 namespace f64  {
     using Flow      = ventilation::Flow<double>;
@@ -243,6 +315,78 @@ namespace f64  {
             RC_ASSERT(expected == actual);
         }
     }
+
+    RC_GTEST_PROP(Batch, Flow, (const Flow& xs)) {
+        control::Gain<Flow>         gain(0.5);
+        control::Differential<Flow> batched(gain, xs);
+        control::Differential<Flow> single(gain, xs);
+
+        std::vector<control::Process<Flow>> processes;
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            processes.push_back({scale * xs, Time(1ms)});
+        }
+
+        std::vector<control::Value<double>> output(processes.size());
+        std::span<const control::Process<Flow>> all(processes);
+        batched(all.first(50), std::span(output).first(50));
+        batched(all.subspan(50), std::span(output).subspan(50));
+
+        for (std::size_t i = 0; i < processes.size(); i++) {
+            Flow expected   = single(processes[i]);
+            Flow actual     = output[i];
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Batch, Pressure, (const Pressure& xs)) {
+        control::Gain<Pressure>         gain(0.5);
+        control::Differential<Pressure> batched(gain, xs);
+        control::Differential<Pressure> single(gain, xs);
+
+        std::vector<control::Process<Pressure>> processes;
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            processes.push_back({scale * xs, Time(1ms)});
+        }
+
+        std::vector<control::Value<double>> output(processes.size());
+        std::span<const control::Process<Pressure>> all(processes);
+        batched(all.first(50), std::span(output).first(50));
+        batched(all.subspan(50), std::span(output).subspan(50));
+
+        for (std::size_t i = 0; i < processes.size(); i++) {
+            Pressure expected   = single(processes[i]);
+            Pressure actual     = output[i];
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Batch, Volume, (const Volume& xs)) {
+        control::Gain<Volume>         gain(0.5);
+        control::Differential<Volume> batched(gain, xs);
+        control::Differential<Volume> single(gain, xs);
+
+        std::vector<control::Process<Volume>> processes;
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            processes.push_back({scale * xs, Time(1ms)});
+        }
+
+        std::vector<control::Value<double>> output(processes.size());
+        std::span<const control::Process<Volume>> all(processes);
+        batched(all.first(50), std::span(output).first(50));
+        batched(all.subspan(50), std::span(output).subspan(50));
+
+        for (std::size_t i = 0; i < processes.size(); i++) {
+            Volume expected   = single(processes[i]);
+            Volume actual     = output[i];
+
+            RC_ASSERT(expected == actual);
+        }
+    }
 }// namespace f64
 namespace f128 {
     using Flow      = ventilation::Flow<long double>;
@@ -343,6 +487,78 @@ namespace f128 {
             RC_ASSERT(expected == actual);
         }
     }
+
+    RC_GTEST_PROP(Batch, Flow, (const Flow& xs)) {
+        control::Gain<Flow>         gain(0.5L);
+        control::Differential<Flow> batched(gain, xs);
+        control::Differential<Flow> single(gain, xs);
+
+        std::vector<control::Process<Flow>> processes;
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            processes.push_back({scale * xs, Time(1ms)});
+        }
+
+        std::vector<control::Value<long double>> output(processes.size());
+        std::span<const control::Process<Flow>> all(processes);
+        batched(all.first(50), std::span(output).first(50));
+        batched(all.subspan(50), std::span(output).subspan(50));
+
+        for (std::size_t i = 0; i < processes.size(); i++) {
+            Flow expected   = single(processes[i]);
+            Flow actual     = output[i];
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Batch, Pressure, (const Pressure& xs)) {
+        control::Gain<Pressure>         gain(0.5L);
+        control::Differential<Pressure> batched(gain, xs);
+        control::Differential<Pressure> single(gain, xs);
+
+        std::vector<control::Process<Pressure>> processes;
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            processes.push_back({scale * xs, Time(1ms)});
+        }
+
+        std::vector<control::Value<long double>> output(processes.size());
+        std::span<const control::Process<Pressure>> all(processes);
+        batched(all.first(50), std::span(output).first(50));
+        batched(all.subspan(50), std::span(output).subspan(50));
+
+        for (std::size_t i = 0; i < processes.size(); i++) {
+            Pressure expected   = single(processes[i]);
+            Pressure actual     = output[i];
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Batch, Volume, (const Volume& xs)) {
+        control::Gain<Volume>         gain(0.5L);
+        control::Differential<Volume> batched(gain, xs);
+        control::Differential<Volume> single(gain, xs);
+
+        std::vector<control::Process<Volume>> processes;
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            processes.push_back({scale * xs, Time(1ms)});
+        }
+
+        std::vector<control::Value<long double>> output(processes.size());
+        std::span<const control::Process<Volume>> all(processes);
+        batched(all.first(50), std::span(output).first(50));
+        batched(all.subspan(50), std::span(output).subspan(50));
+
+        for (std::size_t i = 0; i < processes.size(); i++) {
+            Volume expected   = single(processes[i]);
+            Volume actual     = output[i];
+
+            RC_ASSERT(expected == actual);
+        }
+    }
 } // namespace f128
 
 int
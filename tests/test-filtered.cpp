@@ -0,0 +1,379 @@
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+#include <control/control.hpp>
+
+namespace rc {
+    template<typename Precision>
+    struct Arbitrary<ventilation::Flow<Precision>> {
+        static Gen<ventilation::Flow<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Flow<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::Pressure<Precision>> {
+        static Gen<ventilation::Pressure<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Pressure<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::PEEP<Precision>> {
+        static Gen<ventilation::PEEP<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::PEEP<Precision>>(
+                    gen::arbitrary<ventilation::Pressure<Precision>>()
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::Volume<Precision>> {
+        static Gen<ventilation::Volume<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Volume<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+} // namespace rc
+
+namespace f32 {
+    using Flow      = ventilation::Flow<float>;
+    using Pressure  = ventilation::Pressure<float>;
+    using Volume    = ventilation::Volume<float>;
+    using Time      = control::Time<float>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Unfiltered, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>                 gain(3e-4f);
+        control::Differential<Flow>         differential(gain, xs);
+        control::FilteredDifferential<Flow> filtered(gain, xs, Time(0s));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i % 10) / 10.0f;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = differential(process);
+            Flow actual     = filtered(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Decay, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        Time filter   = 4ms;
+        control::Gain<Flow>                 gain(1.0f);
+        control::FilteredDifferential<Flow> filtered(gain, xs, filter, duration);
+        control::Process<Flow> process{Flow(0.0f), duration};
+
+        float decay = filter.count() / (filter.count() + duration.count());
+        Flow expected = xs * (1.0f / (filter.count() + duration.count()));
+        for (std::size_t i = 0; i < 100; i++) {
+            Flow actual = filtered(process);
+
+            RC_ASSERT(expected == actual);
+            expected = decay * expected;
+        }
+    }
+
+    RC_GTEST_PROP(Unfiltered, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>                 gain(3e-4f);
+        control::Differential<Pressure>         differential(gain, xs);
+        control::FilteredDifferential<Pressure> filtered(gain, xs, Time(0s));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i % 10) / 10.0f;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = differential(process);
+            Pressure actual     = filtered(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Decay, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        Time filter   = 4ms;
+        control::Gain<Pressure>                 gain(1.0f);
+        control::FilteredDifferential<Pressure> filtered(gain, xs, filter, duration);
+        control::Process<Pressure> process{Pressure(0.0f), duration};
+
+        float decay = filter.count() / (filter.count() + duration.count());
+        Pressure expected = xs * (1.0f / (filter.count() + duration.count()));
+        for (std::size_t i = 0; i < 100; i++) {
+            Pressure actual = filtered(process);
+
+            RC_ASSERT(expected == actual);
+            expected = decay * expected;
+        }
+    }
+
+    RC_GTEST_PROP(Unfiltered, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>                 gain(3e-4f);
+        control::Differential<Volume>         differential(gain, xs);
+        control::FilteredDifferential<Volume> filtered(gain, xs, Time(0s));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i % 10) / 10.0f;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = differential(process);
+            Volume actual     = filtered(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Decay, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        Time filter   = 4ms;
+        control::Gain<Volume>                 gain(1.0f);
+        control::FilteredDifferential<Volume> filtered(gain, xs, filter, duration);
+        control::Process<Volume> process{Volume(0.0f), duration};
+
+        float decay = filter.count() / (filter.count() + duration.count());
+        Volume expected = xs * (1.0f / (filter.count() + duration.count()));
+        for (std::size_t i = 0; i < 100; i++) {
+            Volume actual = filtered(process);
+
+            RC_ASSERT(expected == actual);
+            expected = decay * expected;
+        }
+    }
+} // namespace f32
+namespace f64 {
+    using Flow      = ventilation::Flow<double>;
+    using Pressure  = ventilation::Pressure<double>;
+    using Volume    = ventilation::Volume<double>;
+    using Time      = control::Time<double>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Unfiltered, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>                 gain(3e-4);
+        control::Differential<Flow>         differential(gain, xs);
+        control::FilteredDifferential<Flow> filtered(gain, xs, Time(0s));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i % 10) / 10.0;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = differential(process);
+            Flow actual     = filtered(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Decay, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        Time filter   = 4ms;
+        control::Gain<Flow>                 gain(1.0);
+        control::FilteredDifferential<Flow> filtered(gain, xs, filter, duration);
+        control::Process<Flow> process{Flow(0.0), duration};
+
+        double decay = filter.count() / (filter.count() + duration.count());
+        Flow expected = xs * (1.0 / (filter.count() + duration.count()));
+        for (std::size_t i = 0; i < 100; i++) {
+            Flow actual = filtered(process);
+
+            RC_ASSERT(expected == actual);
+            expected = decay * expected;
+        }
+    }
+
+    RC_GTEST_PROP(Unfiltered, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>                 gain(3e-4);
+        control::Differential<Pressure>         differential(gain, xs);
+        control::FilteredDifferential<Pressure> filtered(gain, xs, Time(0s));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i % 10) / 10.0;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = differential(process);
+            Pressure actual     = filtered(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Decay, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        Time filter   = 4ms;
+        control::Gain<Pressure>                 gain(1.0);
+        control::FilteredDifferential<Pressure> filtered(gain, xs, filter, duration);
+        control::Process<Pressure> process{Pressure(0.0), duration};
+
+        double decay = filter.count() / (filter.count() + duration.count());
+        Pressure expected = xs * (1.0 / (filter.count() + duration.count()));
+        for (std::size_t i = 0; i < 100; i++) {
+            Pressure actual = filtered(process);
+
+            RC_ASSERT(expected == actual);
+            expected = decay * expected;
+        }
+    }
+
+    RC_GTEST_PROP(Unfiltered, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>                 gain(3e-4);
+        control::Differential<Volume>         differential(gain, xs);
+        control::FilteredDifferential<Volume> filtered(gain, xs, Time(0s));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i % 10) / 10.0;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = differential(process);
+            Volume actual     = filtered(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Decay, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        Time filter   = 4ms;
+        control::Gain<Volume>                 gain(1.0);
+        control::FilteredDifferential<Volume> filtered(gain, xs, filter, duration);
+        control::Process<Volume> process{Volume(0.0), duration};
+
+        double decay = filter.count() / (filter.count() + duration.count());
+        Volume expected = xs * (1.0 / (filter.count() + duration.count()));
+        for (std::size_t i = 0; i < 100; i++) {
+            Volume actual = filtered(process);
+
+            RC_ASSERT(expected == actual);
+            expected = decay * expected;
+        }
+    }
+} // namespace f64
+namespace f128 {
+    using Flow      = ventilation::Flow<long double>;
+    using Pressure  = ventilation::Pressure<long double>;
+    using Volume    = ventilation::Volume<long double>;
+    using Time      = control::Time<long double>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Unfiltered, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>                 gain(3e-4L);
+        control::Differential<Flow>         differential(gain, xs);
+        control::FilteredDifferential<Flow> filtered(gain, xs, Time(0s));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i % 10) / 10.0L;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = differential(process);
+            Flow actual     = filtered(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Decay, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        Time filter   = 4ms;
+        control::Gain<Flow>                 gain(1.0L);
+        control::FilteredDifferential<Flow> filtered(gain, xs, filter, duration);
+        control::Process<Flow> process{Flow(0.0L), duration};
+
+        long double decay = filter.count() / (filter.count() + duration.count());
+        Flow expected = xs * (1.0L / (filter.count() + duration.count()));
+        for (std::size_t i = 0; i < 100; i++) {
+            Flow actual = filtered(process);
+
+            RC_ASSERT(expected == actual);
+            expected = decay * expected;
+        }
+    }
+
+    RC_GTEST_PROP(Unfiltered, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>                 gain(3e-4L);
+        control::Differential<Pressure>         differential(gain, xs);
+        control::FilteredDifferential<Pressure> filtered(gain, xs, Time(0s));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i % 10) / 10.0L;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = differential(process);
+            Pressure actual     = filtered(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Decay, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        Time filter   = 4ms;
+        control::Gain<Pressure>                 gain(1.0L);
+        control::FilteredDifferential<Pressure> filtered(gain, xs, filter, duration);
+        control::Process<Pressure> process{Pressure(0.0L), duration};
+
+        long double decay = filter.count() / (filter.count() + duration.count());
+        Pressure expected = xs * (1.0L / (filter.count() + duration.count()));
+        for (std::size_t i = 0; i < 100; i++) {
+            Pressure actual = filtered(process);
+
+            RC_ASSERT(expected == actual);
+            expected = decay * expected;
+        }
+    }
+
+    RC_GTEST_PROP(Unfiltered, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>                 gain(3e-4L);
+        control::Differential<Volume>         differential(gain, xs);
+        control::FilteredDifferential<Volume> filtered(gain, xs, Time(0s));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i % 10) / 10.0L;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = differential(process);
+            Volume actual     = filtered(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Decay, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        Time filter   = 4ms;
+        control::Gain<Volume>                 gain(1.0L);
+        control::FilteredDifferential<Volume> filtered(gain, xs, filter, duration);
+        control::Process<Volume> process{Volume(0.0L), duration};
+
+        long double decay = filter.count() / (filter.count() + duration.count());
+        Volume expected = xs * (1.0L / (filter.count() + duration.count()));
+        for (std::size_t i = 0; i < 100; i++) {
+            Volume actual = filtered(process);
+
+            RC_ASSERT(expected == actual);
+            expected = decay * expected;
+        }
+    }
+} // namespace f128
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,220 @@
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+#include <control/control.hpp>
+#include <cmath>
+#include <limits>
+
+namespace rc {
+    template<typename Precision>
+    struct Arbitrary<ventilation::Flow<Precision>> {
+        static Gen<ventilation::Flow<Precision>>
+        arbitrary() {
+            return gen::map(gen::inRange(-16384, 16384), [](int x) {
+                    return ventilation::Flow<Precision>(Precision(static_cast<float>(x) / 32768.0f));
+                    });
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::Pressure<Precision>> {
+        static Gen<ventilation::Pressure<Precision>>
+        arbitrary() {
+            return gen::map(gen::inRange(-16384, 16384), [](int x) {
+                    return ventilation::Pressure<Precision>(Precision(static_cast<float>(x) / 32768.0f));
+                    });
+        }
+    };
+} // namespace rc
+
+template <typename Fixed, typename Target>
+float
+real(const Target& value) {
+    return static_cast<float>(static_cast<Fixed>(value));
+}
+
+namespace arithmetic {
+    using control::Q15;
+    using control::Q31;
+
+    TEST(Saturation, Q15) {
+        EXPECT_EQ(std::numeric_limits<Q15>::max(), Q15(0.75) + Q15(0.75));
+        EXPECT_EQ(std::numeric_limits<Q15>::lowest(), Q15(-0.75) - Q15(0.75));
+        EXPECT_EQ(std::numeric_limits<Q15>::max(), Q15(-1.0) * Q15(-1.0));
+        EXPECT_EQ(std::numeric_limits<Q15>::max(), Q15(2.0));
+        EXPECT_EQ(std::numeric_limits<Q15>::max(), -Q15(-1.0));
+        EXPECT_EQ(std::numeric_limits<Q15>::max(), Q15(0.5) / Q15(0.25));
+        EXPECT_EQ(std::numeric_limits<Q15>::max(), Q15(0.5) / Q15(0.0));
+    }
+
+    TEST(Saturation, Q31) {
+        EXPECT_EQ(std::numeric_limits<Q31>::max(), Q31(0.75) + Q31(0.75));
+        EXPECT_EQ(std::numeric_limits<Q31>::lowest(), Q31(-0.75) - Q31(0.75));
+        EXPECT_EQ(std::numeric_limits<Q31>::max(), Q31(-1.0) * Q31(-1.0));
+        EXPECT_EQ(std::numeric_limits<Q31>::lowest(), Q31(-2.0));
+    }
+
+    RC_GTEST_PROP(Product, Q15, (int a, int b)) {
+        float x = static_cast<float>(a % 32768) / 32768.0f;
+        float y = static_cast<float>(b % 32768) / 32768.0f;
+        float actual = static_cast<float>(Q15(x) * Q15(y));
+        RC_ASSERT(std::abs(actual - x * y) <= 1.0f / 32768.0f);
+    }
+
+    RC_GTEST_PROP(Product, Q31, (int a, int b)) {
+        double x = static_cast<double>(a % 32768) / 32768.0;
+        double y = static_cast<double>(b % 32768) / 32768.0;
+        double actual = static_cast<double>(Q31(x) * Q31(y));
+        RC_ASSERT(std::abs(actual - x * y) <= 1.0 / 2147483648.0);
+    }
+} // namespace arithmetic
+
+namespace q15 {
+    using Q15       = control::Q15;
+    using Flow      = ventilation::Flow<Q15>;
+    using Pressure  = ventilation::Pressure<Q15>;
+    using Time      = control::Time<Q15>;
+    const float TOLERANCE = 1.0f / 256.0f;
+
+    RC_GTEST_PROP(Proportional, Flow, (const Flow& xs)) {
+        control::Gain<Flow>          gain(Q15(0.5));
+        control::Proportional<Flow>  fixed(gain, xs);
+        control::Gain<ventilation::Flow<float>>         reference_gain(0.5f);
+        control::Proportional<ventilation::Flow<float>> reference(
+            reference_gain, ventilation::Flow<float>(real<Q15>(xs)));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float measurement = static_cast<float>(i) / 256.0f - 0.25f;
+            control::Process<Flow> process{Flow(Q15(measurement)), Time(Q15(1e-3))};
+            control::Process<ventilation::Flow<float>> expected{
+                ventilation::Flow<float>(measurement), control::Time<float>(1e-3f)};
+
+            float actual = real<Q15>(Flow(fixed(process)));
+            RC_ASSERT(std::abs(actual - static_cast<float>(ventilation::Flow<float>(reference(expected)))) <= TOLERANCE);
+        }
+    }
+
+    RC_GTEST_PROP(Integral, Pressure, (const Pressure& xs)) {
+        control::Gain<Pressure>         gain(Q15(0.5));
+        control::Integral<Pressure>     fixed(gain, xs);
+        control::Gain<ventilation::Pressure<float>>     reference_gain(0.5f);
+        control::Integral<ventilation::Pressure<float>> reference(
+            reference_gain, ventilation::Pressure<float>(real<Q15>(xs)));
+
+        control::Process<Pressure> process{Pressure(Q15(0.0)), Time(Q15(1.0 / 1024.0))};
+        control::Process<ventilation::Pressure<float>> expected{
+            ventilation::Pressure<float>(0.0f), control::Time<float>(1.0f / 1024.0f)};
+        for (std::size_t i = 0; i < 100; i++) {
+            float actual    = real<Q15>(Pressure(fixed(process)));
+            float wanted    = static_cast<float>(ventilation::Pressure<float>(reference(expected)));
+            RC_ASSERT(std::abs(actual - wanted) <= TOLERANCE);
+        }
+    }
+    RC_GTEST_PROP(Differential, Pressure, (const Pressure& xs)) {
+        control::Gain<Pressure>         gain(Q15(1.0 / 64.0));
+        control::Differential<Pressure> fixed(gain, xs);
+        control::Gain<ventilation::Pressure<float>>         reference_gain(1.0f / 64.0f);
+        control::Differential<ventilation::Pressure<float>> reference(
+            reference_gain, ventilation::Pressure<float>(real<Q15>(xs)));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float measurement = static_cast<float>(i % 7) / 256.0f;
+            control::Process<Pressure> process{Pressure(Q15(measurement)), Time(Q15(1.0 / 64.0))};
+            control::Process<ventilation::Pressure<float>> expected{
+                ventilation::Pressure<float>(measurement), control::Time<float>(1.0f / 64.0f)};
+
+            float actual = real<Q15>(Pressure(fixed(process)));
+            RC_ASSERT(std::abs(actual - static_cast<float>(ventilation::Pressure<float>(reference(expected)))) <= TOLERANCE);
+        }
+    }
+} // namespace q15
+
+namespace q31 {
+    using Q31       = control::Q31;
+    using Flow      = ventilation::Flow<Q31>;
+    using Pressure  = ventilation::Pressure<Q31>;
+    using Time      = control::Time<Q31>;
+    const float TOLERANCE = 1.0f / 65536.0f;
+
+    RC_GTEST_PROP(Integral, Flow, (const Flow& xs)) {
+        control::Gain<Flow>         gain(Q31(0.5));
+        control::Integral<Flow>     fixed(gain, xs);
+        control::Gain<ventilation::Flow<float>>     reference_gain(0.5f);
+        control::Integral<ventilation::Flow<float>> reference(
+            reference_gain, ventilation::Flow<float>(real<Q31>(xs)));
+
+        control::Process<Flow> process{Flow(Q31(0.0)), Time(Q31(1e-3))};
+        control::Process<ventilation::Flow<float>> expected{
+            ventilation::Flow<float>(0.0f), control::Time<float>(1e-3f)};
+        for (std::size_t i = 0; i < 100; i++) {
+            float actual    = real<Q31>(Flow(fixed(process)));
+            float wanted    = static_cast<float>(ventilation::Flow<float>(reference(expected)));
+            RC_ASSERT(std::abs(actual - wanted) <= TOLERANCE);
+        }
+    }
+
+    RC_GTEST_PROP(Proportional, Pressure, (const Pressure& xs)) {
+        control::Gain<Pressure>         gain(Q31(0.25));
+        control::Proportional<Pressure> fixed(gain, xs);
+        control::Gain<ventilation::Pressure<float>>         reference_gain(0.25f);
+        control::Proportional<ventilation::Pressure<float>> reference(
+            reference_gain, ventilation::Pressure<float>(real<Q31>(xs)));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float measurement = static_cast<float>(i) / 256.0f - 0.25f;
+            control::Process<Pressure> process{Pressure(Q31(measurement)), Time(Q31(1e-3))};
+            control::Process<ventilation::Pressure<float>> expected{
+                ventilation::Pressure<float>(measurement), control::Time<float>(1e-3f)};
+
+            float actual = real<Q31>(Pressure(fixed(process)));
+            RC_ASSERT(std::abs(actual - static_cast<float>(ventilation::Pressure<float>(reference(expected)))) <= TOLERANCE);
+        }
+    }
+    RC_GTEST_PROP(Differential, Pressure, (const Pressure& xs)) {
+        control::Gain<Pressure>         gain(Q31(1.0 / 64.0));
+        control::Differential<Pressure> fixed(gain, xs);
+        control::Gain<ventilation::Pressure<float>>         reference_gain(1.0f / 64.0f);
+        control::Differential<ventilation::Pressure<float>> reference(
+            reference_gain, ventilation::Pressure<float>(real<Q31>(xs)));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float measurement = static_cast<float>(i % 7) / 256.0f;
+            control::Process<Pressure> process{Pressure(Q31(measurement)), Time(Q31(1.0 / 64.0))};
+            control::Process<ventilation::Pressure<float>> expected{
+                ventilation::Pressure<float>(measurement), control::Time<float>(1.0f / 64.0f)};
+
+            float actual = real<Q31>(Pressure(fixed(process)));
+            RC_ASSERT(std::abs(actual - static_cast<float>(ventilation::Pressure<float>(reference(expected)))) <= TOLERANCE);
+        }
+    }
+} // namespace q31
+
+namespace q16 {
+    using Q16       = control::Fixed<std::int32_t, 16>;
+    using Pressure  = ventilation::Pressure<Q16>;
+    using Time      = control::Time<Q16>;
+    const float TOLERANCE = 1.0f / 256.0f;
+
+    RC_GTEST_PROP(Differential, Pressure, (const Pressure& xs)) {
+        control::Gain<Pressure>         gain(Q16(0.25));
+        control::Differential<Pressure> fixed(gain, xs);
+        control::Gain<ventilation::Pressure<float>>         reference_gain(0.25f);
+        control::Differential<ventilation::Pressure<float>> reference(
+            reference_gain, ventilation::Pressure<float>(real<Q16>(xs)));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float measurement = static_cast<float>(i % 7) / 64.0f;
+            control::Process<Pressure> process{Pressure(Q16(measurement)), Time(Q16(1.0 / 64.0))};
+            control::Process<ventilation::Pressure<float>> expected{
+                ventilation::Pressure<float>(measurement), control::Time<float>(1.0f / 64.0f)};
+
+            float actual = real<Q16>(Pressure(fixed(process)));
+            RC_ASSERT(std::abs(actual - static_cast<float>(ventilation::Pressure<float>(reference(expected)))) <= TOLERANCE);
+        }
+    }
+} // namespace q16
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,352 @@
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+#include <control/control.hpp>
+
+namespace rc {
+    template<typename Precision>
+    struct Arbitrary<ventilation::Flow<Precision>> {
+        static Gen<ventilation::Flow<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Flow<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::Pressure<Precision>> {
+        static Gen<ventilation::Pressure<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Pressure<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::PEEP<Precision>> {
+        static Gen<ventilation::PEEP<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::PEEP<Precision>>(
+                    gen::arbitrary<ventilation::Pressure<Precision>>()
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::Volume<Precision>> {
+        static Gen<ventilation::Volume<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Volume<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+} // namespace rc
+
+namespace f32 {
+    using Flow      = ventilation::Flow<float>;
+    using Pressure  = ventilation::Pressure<float>;
+    using Volume    = ventilation::Volume<float>;
+    using Time      = control::Time<float>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Positional, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>        kp(0.5f);
+        control::Gain<Flow>        ki(5.0e1f);
+        control::Gain<Flow>        kd(3e-4f);
+        control::PeriodicPID<Flow> positional(kp, ki, kd, xs, duration);
+        control::Incremental<Flow> incremental(kp, ki, kd, xs, duration);
+
+        Flow output{};
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            control::Process<Flow> process{scale * xs, duration};
+
+            output += incremental(process);
+            Flow expected = positional(process);
+
+            RC_ASSERT(expected == output);
+        }
+    }
+
+    RC_GTEST_PROP(Steady, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>        ki(5.0e1f);
+        control::Incremental<Flow> incremental(control::Gain<Flow>(), ki, control::Gain<Flow>(), xs, duration);
+        control::Process<Flow> process{xs, duration};
+
+        for (std::size_t i = 0; i < 100; i++) {
+            RC_ASSERT(Flow() == incremental(process));
+        }
+    }
+
+    RC_GTEST_PROP(Positional, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>        kp(0.5f);
+        control::Gain<Pressure>        ki(5.0e1f);
+        control::Gain<Pressure>        kd(3e-4f);
+        control::PeriodicPID<Pressure> positional(kp, ki, kd, xs, duration);
+        control::Incremental<Pressure> incremental(kp, ki, kd, xs, duration);
+
+        Pressure output{};
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            output += incremental(process);
+            Pressure expected = positional(process);
+
+            RC_ASSERT(expected == output);
+        }
+    }
+
+    RC_GTEST_PROP(Steady, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>        ki(5.0e1f);
+        control::Incremental<Pressure> incremental(control::Gain<Pressure>(), ki, control::Gain<Pressure>(), xs, duration);
+        control::Process<Pressure> process{xs, duration};
+
+        for (std::size_t i = 0; i < 100; i++) {
+            RC_ASSERT(Pressure() == incremental(process));
+        }
+    }
+
+    RC_GTEST_PROP(Positional, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>        kp(0.5f);
+        control::Gain<Volume>        ki(5.0e1f);
+        control::Gain<Volume>        kd(3e-4f);
+        control::PeriodicPID<Volume> positional(kp, ki, kd, xs, duration);
+        control::Incremental<Volume> incremental(kp, ki, kd, xs, duration);
+
+        Volume output{};
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            control::Process<Volume> process{scale * xs, duration};
+
+            output += incremental(process);
+            Volume expected = positional(process);
+
+            RC_ASSERT(expected == output);
+        }
+    }
+
+    RC_GTEST_PROP(Steady, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>        ki(5.0e1f);
+        control::Incremental<Volume> incremental(control::Gain<Volume>(), ki, control::Gain<Volume>(), xs, duration);
+        control::Process<Volume> process{xs, duration};
+
+        for (std::size_t i = 0; i < 100; i++) {
+            RC_ASSERT(Volume() == incremental(process));
+        }
+    }
+} // namespace f32
+namespace f64 {
+    using Flow      = ventilation::Flow<double>;
+    using Pressure  = ventilation::Pressure<double>;
+    using Volume    = ventilation::Volume<double>;
+    using Time      = control::Time<double>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Positional, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>        kp(0.5);
+        control::Gain<Flow>        ki(5.0e1);
+        control::Gain<Flow>        kd(3e-4);
+        control::PeriodicPID<Flow> positional(kp, ki, kd, xs, duration);
+        control::Incremental<Flow> incremental(kp, ki, kd, xs, duration);
+
+        Flow output{};
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            control::Process<Flow> process{scale * xs, duration};
+
+            output += incremental(process);
+            Flow expected = positional(process);
+
+            RC_ASSERT(expected == output);
+        }
+    }
+
+    RC_GTEST_PROP(Steady, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>        ki(5.0e1);
+        control::Incremental<Flow> incremental(control::Gain<Flow>(), ki, control::Gain<Flow>(), xs, duration);
+        control::Process<Flow> process{xs, duration};
+
+        for (std::size_t i = 0; i < 100; i++) {
+            RC_ASSERT(Flow() == incremental(process));
+        }
+    }
+
+    RC_GTEST_PROP(Positional, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>        kp(0.5);
+        control::Gain<Pressure>        ki(5.0e1);
+        control::Gain<Pressure>        kd(3e-4);
+        control::PeriodicPID<Pressure> positional(kp, ki, kd, xs, duration);
+        control::Incremental<Pressure> incremental(kp, ki, kd, xs, duration);
+
+        Pressure output{};
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            output += incremental(process);
+            Pressure expected = positional(process);
+
+            RC_ASSERT(expected == output);
+        }
+    }
+
+    RC_GTEST_PROP(Steady, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>        ki(5.0e1);
+        control::Incremental<Pressure> incremental(control::Gain<Pressure>(), ki, control::Gain<Pressure>(), xs, duration);
+        control::Process<Pressure> process{xs, duration};
+
+        for (std::size_t i = 0; i < 100; i++) {
+            RC_ASSERT(Pressure() == incremental(process));
+        }
+    }
+
+    RC_GTEST_PROP(Positional, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>        kp(0.5);
+        control::Gain<Volume>        ki(5.0e1);
+        control::Gain<Volume>        kd(3e-4);
+        control::PeriodicPID<Volume> positional(kp, ki, kd, xs, duration);
+        control::Incremental<Volume> incremental(kp, ki, kd, xs, duration);
+
+        Volume output{};
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            control::Process<Volume> process{scale * xs, duration};
+
+            output += incremental(process);
+            Volume expected = positional(process);
+
+            RC_ASSERT(expected == output);
+        }
+    }
+
+    RC_GTEST_PROP(Steady, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>        ki(5.0e1);
+        control::Incremental<Volume> incremental(control::Gain<Volume>(), ki, control::Gain<Volume>(), xs, duration);
+        control::Process<Volume> process{xs, duration};
+
+        for (std::size_t i = 0; i < 100; i++) {
+            RC_ASSERT(Volume() == incremental(process));
+        }
+    }
+} // namespace f64
+namespace f128 {
+    using Flow      = ventilation::Flow<long double>;
+    using Pressure  = ventilation::Pressure<long double>;
+    using Volume    = ventilation::Volume<long double>;
+    using Time      = control::Time<long double>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Positional, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>        kp(0.5L);
+        control::Gain<Flow>        ki(5.0e1L);
+        control::Gain<Flow>        kd(3e-4L);
+        control::PeriodicPID<Flow> positional(kp, ki, kd, xs, duration);
+        control::Incremental<Flow> incremental(kp, ki, kd, xs, duration);
+
+        Flow output{};
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            control::Process<Flow> process{scale * xs, duration};
+
+            output += incremental(process);
+            Flow expected = positional(process);
+
+            RC_ASSERT(expected == output);
+        }
+    }
+
+    RC_GTEST_PROP(Steady, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>        ki(5.0e1L);
+        control::Incremental<Flow> incremental(control::Gain<Flow>(), ki, control::Gain<Flow>(), xs, duration);
+        control::Process<Flow> process{xs, duration};
+
+        for (std::size_t i = 0; i < 100; i++) {
+            RC_ASSERT(Flow() == incremental(process));
+        }
+    }
+
+    RC_GTEST_PROP(Positional, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>        kp(0.5L);
+        control::Gain<Pressure>        ki(5.0e1L);
+        control::Gain<Pressure>        kd(3e-4L);
+        control::PeriodicPID<Pressure> positional(kp, ki, kd, xs, duration);
+        control::Incremental<Pressure> incremental(kp, ki, kd, xs, duration);
+
+        Pressure output{};
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            output += incremental(process);
+            Pressure expected = positional(process);
+
+            RC_ASSERT(expected == output);
+        }
+    }
+
+    RC_GTEST_PROP(Steady, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>        ki(5.0e1L);
+        control::Incremental<Pressure> incremental(control::Gain<Pressure>(), ki, control::Gain<Pressure>(), xs, duration);
+        control::Process<Pressure> process{xs, duration};
+
+        for (std::size_t i = 0; i < 100; i++) {
+            RC_ASSERT(Pressure() == incremental(process));
+        }
+    }
+
+    RC_GTEST_PROP(Positional, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>        kp(0.5L);
+        control::Gain<Volume>        ki(5.0e1L);
+        control::Gain<Volume>        kd(3e-4L);
+        control::PeriodicPID<Volume> positional(kp, ki, kd, xs, duration);
+        control::Incremental<Volume> incremental(kp, ki, kd, xs, duration);
+
+        Volume output{};
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            control::Process<Volume> process{scale * xs, duration};
+
+            output += incremental(process);
+            Volume expected = positional(process);
+
+            RC_ASSERT(expected == output);
+        }
+    }
+
+    RC_GTEST_PROP(Steady, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>        ki(5.0e1L);
+        control::Incremental<Volume> incremental(control::Gain<Volume>(), ki, control::Gain<Volume>(), xs, duration);
+        control::Process<Volume> process{xs, duration};
+
+        for (std::size_t i = 0; i < 100; i++) {
+            RC_ASSERT(Volume() == incremental(process));
+        }
+    }
+} // namespace f128
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include <control/control.hpp>
+#include <numeric>
+
+static_assert(!control::instrumented);
+static_assert(std::is_same_v<control::Recorder, control::Disabled>);
+
+namespace f32 {
+    using Flow      = ventilation::Flow<float>;
+    using Pressure  = ventilation::Pressure<float>;
+    using Time      = control::Time<float>;
+    using namespace std::chrono_literals;
+
+    TEST(Disabled, Size) {
+        EXPECT_EQ(sizeof(control::PID<Flow>), sizeof(control::Instrumented<control::PID<Flow>>));
+        EXPECT_EQ(sizeof(control::Proportional<Pressure>), sizeof(control::Instrumented<control::Proportional<Pressure>>));
+        EXPECT_EQ(sizeof(control::Integral<Pressure>), sizeof(control::Instrumented<control::Integral<Pressure>>));
+    }
+
+    TEST(Disabled, Transparent) {
+        Time duration = 1ms;
+        control::Gain<Flow>                       kp(0.5f);
+        control::Gain<Flow>                       ki(5.0e1f);
+        control::Gain<Flow>                       kd(3e-4f);
+        control::PID<Flow>                        bare(kp, ki, kd, Flow(1.0f));
+        control::Instrumented<control::PID<Flow>> instrumented(control::PID<Flow>(kp, ki, kd, Flow(1.0f)));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            control::Process<Flow> process{Flow(static_cast<float>(i) / 100.0f), duration};
+            EXPECT_EQ(Flow(bare(process)), Flow(instrumented(process)));
+        }
+
+        control::Snapshot snapshot = instrumented.snapshot();
+        EXPECT_EQ(0u, snapshot.calls);
+        EXPECT_EQ(0u, snapshot.worst);
+        EXPECT_EQ(0u, std::accumulate(snapshot.histogram.begin(), snapshot.histogram.end(), std::uint64_t(0)));
+    }
+
+    TEST(Disabled, Measure) {
+        control::Recorder recorder;
+        Pressure actual = control::measure(recorder, [] { return Pressure(2.0f); });
+
+        EXPECT_EQ(Pressure(2.0f), actual);
+        EXPECT_EQ(0u, recorder.snapshot().calls);
+    }
+} // namespace f32
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
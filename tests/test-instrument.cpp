@@ -0,0 +1,417 @@
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+#include <control/control.hpp>
+#include <numeric>
+#include <thread>
+
+namespace rc {
+    template<typename Precision>
+    struct Arbitrary<ventilation::Flow<Precision>> {
+        static Gen<ventilation::Flow<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Flow<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::Pressure<Precision>> {
+        static Gen<ventilation::Pressure<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Pressure<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::PEEP<Precision>> {
+        static Gen<ventilation::PEEP<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::PEEP<Precision>>(
+                    gen::arbitrary<ventilation::Pressure<Precision>>()
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::Volume<Precision>> {
+        static Gen<ventilation::Volume<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Volume<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+} // namespace rc
+
+static_assert(control::instrumented);
+static_assert(std::is_same_v<control::Recorder, control::Statistics>);
+
+namespace f32 {
+    using Flow      = ventilation::Flow<float>;
+    using Pressure  = ventilation::Pressure<float>;
+    using Volume    = ventilation::Volume<float>;
+    using Time      = control::Time<float>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Transparent, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>                       kp(0.5f);
+        control::Gain<Flow>                       ki(5.0e1f);
+        control::Gain<Flow>                       kd(3e-4f);
+        control::PID<Flow>                        bare(kp, ki, kd, xs);
+        control::Instrumented<control::PID<Flow>> instrumented(control::PID<Flow>(kp, ki, kd, xs));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = bare(process);
+            Flow actual     = instrumented(process);
+
+            RC_ASSERT(expected == actual);
+        }
+
+        control::Snapshot snapshot = instrumented.snapshot();
+        RC_ASSERT(snapshot.calls == 100u);
+        RC_ASSERT(std::accumulate(snapshot.histogram.begin(), snapshot.histogram.end(), std::uint64_t(0)) == 100u);
+    }
+
+    RC_GTEST_PROP(Visit, Flow, (const Flow& xs)) {
+        control::Control<Flow> controller = control::Proportional<Flow>(control::Gain<Flow>(1.0f), xs);
+        control::Recorder recorder;
+        control::Process<Flow> process{Flow(0.0f), Time(1ms)};
+        control::Action<Flow> action{process};
+
+        Flow actual = control::measure(recorder, [&] { return std::visit(action, controller); });
+
+        RC_ASSERT(xs == actual);
+        RC_ASSERT(recorder.snapshot().calls == 1u);
+    }
+
+    RC_GTEST_PROP(Transparent, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>                       kp(0.5f);
+        control::Gain<Pressure>                       ki(5.0e1f);
+        control::Gain<Pressure>                       kd(3e-4f);
+        control::PID<Pressure>                        bare(kp, ki, kd, xs);
+        control::Instrumented<control::PID<Pressure>> instrumented(control::PID<Pressure>(kp, ki, kd, xs));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = bare(process);
+            Pressure actual     = instrumented(process);
+
+            RC_ASSERT(expected == actual);
+        }
+
+        control::Snapshot snapshot = instrumented.snapshot();
+        RC_ASSERT(snapshot.calls == 100u);
+        RC_ASSERT(std::accumulate(snapshot.histogram.begin(), snapshot.histogram.end(), std::uint64_t(0)) == 100u);
+    }
+
+    RC_GTEST_PROP(Visit, Pressure, (const Pressure& xs)) {
+        control::Control<Pressure> controller = control::Proportional<Pressure>(control::Gain<Pressure>(1.0f), xs);
+        control::Recorder recorder;
+        control::Process<Pressure> process{Pressure(0.0f), Time(1ms)};
+        control::Action<Pressure> action{process};
+
+        Pressure actual = control::measure(recorder, [&] { return std::visit(action, controller); });
+
+        RC_ASSERT(xs == actual);
+        RC_ASSERT(recorder.snapshot().calls == 1u);
+    }
+
+    RC_GTEST_PROP(Transparent, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>                       kp(0.5f);
+        control::Gain<Volume>                       ki(5.0e1f);
+        control::Gain<Volume>                       kd(3e-4f);
+        control::PID<Volume>                        bare(kp, ki, kd, xs);
+        control::Instrumented<control::PID<Volume>> instrumented(control::PID<Volume>(kp, ki, kd, xs));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = bare(process);
+            Volume actual     = instrumented(process);
+
+            RC_ASSERT(expected == actual);
+        }
+
+        control::Snapshot snapshot = instrumented.snapshot();
+        RC_ASSERT(snapshot.calls == 100u);
+        RC_ASSERT(std::accumulate(snapshot.histogram.begin(), snapshot.histogram.end(), std::uint64_t(0)) == 100u);
+    }
+
+    RC_GTEST_PROP(Visit, Volume, (const Volume& xs)) {
+        control::Control<Volume> controller = control::Proportional<Volume>(control::Gain<Volume>(1.0f), xs);
+        control::Recorder recorder;
+        control::Process<Volume> process{Volume(0.0f), Time(1ms)};
+        control::Action<Volume> action{process};
+
+        Volume actual = control::measure(recorder, [&] { return std::visit(action, controller); });
+
+        RC_ASSERT(xs == actual);
+        RC_ASSERT(recorder.snapshot().calls == 1u);
+    }
+} // namespace f32
+namespace f64 {
+    using Flow      = ventilation::Flow<double>;
+    using Pressure  = ventilation::Pressure<double>;
+    using Volume    = ventilation::Volume<double>;
+    using Time      = control::Time<double>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Transparent, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>                       kp(0.5);
+        control::Gain<Flow>                       ki(5.0e1);
+        control::Gain<Flow>                       kd(3e-4);
+        control::PID<Flow>                        bare(kp, ki, kd, xs);
+        control::Instrumented<control::PID<Flow>> instrumented(control::PID<Flow>(kp, ki, kd, xs));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = bare(process);
+            Flow actual     = instrumented(process);
+
+            RC_ASSERT(expected == actual);
+        }
+
+        control::Snapshot snapshot = instrumented.snapshot();
+        RC_ASSERT(snapshot.calls == 100u);
+        RC_ASSERT(std::accumulate(snapshot.histogram.begin(), snapshot.histogram.end(), std::uint64_t(0)) == 100u);
+    }
+
+    RC_GTEST_PROP(Visit, Flow, (const Flow& xs)) {
+        control::Control<Flow> controller = control::Proportional<Flow>(control::Gain<Flow>(1.0), xs);
+        control::Recorder recorder;
+        control::Process<Flow> process{Flow(0.0), Time(1ms)};
+        control::Action<Flow> action{process};
+
+        Flow actual = control::measure(recorder, [&] { return std::visit(action, controller); });
+
+        RC_ASSERT(xs == actual);
+        RC_ASSERT(recorder.snapshot().calls == 1u);
+    }
+
+    RC_GTEST_PROP(Transparent, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>                       kp(0.5);
+        control::Gain<Pressure>                       ki(5.0e1);
+        control::Gain<Pressure>                       kd(3e-4);
+        control::PID<Pressure>                        bare(kp, ki, kd, xs);
+        control::Instrumented<control::PID<Pressure>> instrumented(control::PID<Pressure>(kp, ki, kd, xs));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = bare(process);
+            Pressure actual     = instrumented(process);
+
+            RC_ASSERT(expected == actual);
+        }
+
+        control::Snapshot snapshot = instrumented.snapshot();
+        RC_ASSERT(snapshot.calls == 100u);
+        RC_ASSERT(std::accumulate(snapshot.histogram.begin(), snapshot.histogram.end(), std::uint64_t(0)) == 100u);
+    }
+
+    RC_GTEST_PROP(Visit, Pressure, (const Pressure& xs)) {
+        control::Control<Pressure> controller = control::Proportional<Pressure>(control::Gain<Pressure>(1.0), xs);
+        control::Recorder recorder;
+        control::Process<Pressure> process{Pressure(0.0), Time(1ms)};
+        control::Action<Pressure> action{process};
+
+        Pressure actual = control::measure(recorder, [&] { return std::visit(action, controller); });
+
+        RC_ASSERT(xs == actual);
+        RC_ASSERT(recorder.snapshot().calls == 1u);
+    }
+
+    RC_GTEST_PROP(Transparent, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>                       kp(0.5);
+        control::Gain<Volume>                       ki(5.0e1);
+        control::Gain<Volume>                       kd(3e-4);
+        control::PID<Volume>                        bare(kp, ki, kd, xs);
+        control::Instrumented<control::PID<Volume>> instrumented(control::PID<Volume>(kp, ki, kd, xs));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = bare(process);
+            Volume actual     = instrumented(process);
+
+            RC_ASSERT(expected == actual);
+        }
+
+        control::Snapshot snapshot = instrumented.snapshot();
+        RC_ASSERT(snapshot.calls == 100u);
+        RC_ASSERT(std::accumulate(snapshot.histogram.begin(), snapshot.histogram.end(), std::uint64_t(0)) == 100u);
+    }
+
+    RC_GTEST_PROP(Visit, Volume, (const Volume& xs)) {
+        control::Control<Volume> controller = control::Proportional<Volume>(control::Gain<Volume>(1.0), xs);
+        control::Recorder recorder;
+        control::Process<Volume> process{Volume(0.0), Time(1ms)};
+        control::Action<Volume> action{process};
+
+        Volume actual = control::measure(recorder, [&] { return std::visit(action, controller); });
+
+        RC_ASSERT(xs == actual);
+        RC_ASSERT(recorder.snapshot().calls == 1u);
+    }
+} // namespace f64
+namespace f128 {
+    using Flow      = ventilation::Flow<long double>;
+    using Pressure  = ventilation::Pressure<long double>;
+    using Volume    = ventilation::Volume<long double>;
+    using Time      = control::Time<long double>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Transparent, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>                       kp(0.5L);
+        control::Gain<Flow>                       ki(5.0e1L);
+        control::Gain<Flow>                       kd(3e-4L);
+        control::PID<Flow>                        bare(kp, ki, kd, xs);
+        control::Instrumented<control::PID<Flow>> instrumented(control::PID<Flow>(kp, ki, kd, xs));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = bare(process);
+            Flow actual     = instrumented(process);
+
+            RC_ASSERT(expected == actual);
+        }
+
+        control::Snapshot snapshot = instrumented.snapshot();
+        RC_ASSERT(snapshot.calls == 100u);
+        RC_ASSERT(std::accumulate(snapshot.histogram.begin(), snapshot.histogram.end(), std::uint64_t(0)) == 100u);
+    }
+
+    RC_GTEST_PROP(Visit, Flow, (const Flow& xs)) {
+        control::Control<Flow> controller = control::Proportional<Flow>(control::Gain<Flow>(1.0L), xs);
+        control::Recorder recorder;
+        control::Process<Flow> process{Flow(0.0L), Time(1ms)};
+        control::Action<Flow> action{process};
+
+        Flow actual = control::measure(recorder, [&] { return std::visit(action, controller); });
+
+        RC_ASSERT(xs == actual);
+        RC_ASSERT(recorder.snapshot().calls == 1u);
+    }
+
+    RC_GTEST_PROP(Transparent, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>                       kp(0.5L);
+        control::Gain<Pressure>                       ki(5.0e1L);
+        control::Gain<Pressure>                       kd(3e-4L);
+        control::PID<Pressure>                        bare(kp, ki, kd, xs);
+        control::Instrumented<control::PID<Pressure>> instrumented(control::PID<Pressure>(kp, ki, kd, xs));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = bare(process);
+            Pressure actual     = instrumented(process);
+
+            RC_ASSERT(expected == actual);
+        }
+
+        control::Snapshot snapshot = instrumented.snapshot();
+        RC_ASSERT(snapshot.calls == 100u);
+        RC_ASSERT(std::accumulate(snapshot.histogram.begin(), snapshot.histogram.end(), std::uint64_t(0)) == 100u);
+    }
+
+    RC_GTEST_PROP(Visit, Pressure, (const Pressure& xs)) {
+        control::Control<Pressure> controller = control::Proportional<Pressure>(control::Gain<Pressure>(1.0L), xs);
+        control::Recorder recorder;
+        control::Process<Pressure> process{Pressure(0.0L), Time(1ms)};
+        control::Action<Pressure> action{process};
+
+        Pressure actual = control::measure(recorder, [&] { return std::visit(action, controller); });
+
+        RC_ASSERT(xs == actual);
+        RC_ASSERT(recorder.snapshot().calls == 1u);
+    }
+
+    RC_GTEST_PROP(Transparent, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>                       kp(0.5L);
+        control::Gain<Volume>                       ki(5.0e1L);
+        control::Gain<Volume>                       kd(3e-4L);
+        control::PID<Volume>                        bare(kp, ki, kd, xs);
+        control::Instrumented<control::PID<Volume>> instrumented(control::PID<Volume>(kp, ki, kd, xs));
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = bare(process);
+            Volume actual     = instrumented(process);
+
+            RC_ASSERT(expected == actual);
+        }
+
+        control::Snapshot snapshot = instrumented.snapshot();
+        RC_ASSERT(snapshot.calls == 100u);
+        RC_ASSERT(std::accumulate(snapshot.histogram.begin(), snapshot.histogram.end(), std::uint64_t(0)) == 100u);
+    }
+
+    RC_GTEST_PROP(Visit, Volume, (const Volume& xs)) {
+        control::Control<Volume> controller = control::Proportional<Volume>(control::Gain<Volume>(1.0L), xs);
+        control::Recorder recorder;
+        control::Process<Volume> process{Volume(0.0L), Time(1ms)};
+        control::Action<Volume> action{process};
+
+        Volume actual = control::measure(recorder, [&] { return std::visit(action, controller); });
+
+        RC_ASSERT(xs == actual);
+        RC_ASSERT(recorder.snapshot().calls == 1u);
+    }
+} // namespace f128
+
+TEST(Snapshot, Concurrent) {
+    using Pressure = ventilation::Pressure<float>;
+    control::Instrumented<control::Proportional<Pressure>> proportional(
+        control::Proportional<Pressure>(control::Gain<Pressure>(1.0f), Pressure(1.0f)));
+    control::Process<Pressure> process{Pressure(0.0f), control::Time<float>(1e-3f)};
+
+    std::atomic<bool> done(false);
+    std::thread monitor([&] {
+        std::uint64_t last = 0;
+        while (!done.load()) {
+            std::uint64_t calls = proportional.snapshot().calls;
+            EXPECT_GE(calls, last);
+            last = calls;
+        }
+    });
+    for (std::size_t i = 0; i < 100000; i++) {
+        proportional(process);
+    }
+    done.store(true);
+    monitor.join();
+
+    EXPECT_EQ(100000u, proportional.snapshot().calls);
+}
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
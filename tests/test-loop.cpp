@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <control/control.hpp>
+#include <control/control-loop.hpp>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace f32 {
+    using Pressure  = ventilation::Pressure<float>;
+    using Time      = control::Time<float>;
+    using namespace std::chrono_literals;
+
+    TEST(Loop, Ticks) {
+        control::Loop<Pressure>         loop(Time(1ms));
+        control::Proportional<Pressure> proportional(control::Gain<Pressure>(1.0f), Pressure(1.0f));
+        control::Integral<Pressure>     integral(control::Gain<Pressure>(0.0f), Pressure(1.0f));
+
+        std::size_t sensed = 0;
+        std::vector<Pressure> outputs;
+        loop.run(20
+            , [&] { sensed++; return Pressure(0.25f); }
+            , [&](const control::Value<float>& v) { outputs.push_back(v); }
+            , proportional
+            , integral
+            );
+
+        control::Timing timing = loop.timing();
+        EXPECT_EQ(20u, sensed);
+        EXPECT_EQ(20u, timing.ticks);
+        EXPECT_EQ(20u, outputs.size());
+        for (const Pressure& output : outputs) {
+            EXPECT_EQ(Pressure(0.75f), output);
+        }
+        EXPECT_GE(timing.worst_jitter, timing.total_jitter / 20);
+        EXPECT_GE(timing.worst_latency.count(), 0);
+    }
+
+    TEST(Loop, Duration) {
+        control::Loop<Pressure>     loop(Time(2ms));
+        control::Integral<Pressure> integral(control::Gain<Pressure>(1.0f), Pressure(1.0f));
+
+        std::vector<Pressure> outputs;
+        loop.run(10
+            , [] { return Pressure(0.0f); }
+            , [&](const control::Value<float>& v) { outputs.push_back(v); }
+            , integral
+            );
+
+        ASSERT_EQ(10u, outputs.size());
+        float elapsed = static_cast<float>(outputs.back());
+        EXPECT_GE(elapsed, 0.019f);
+        EXPECT_LE(elapsed, 1.0f);
+    }
+
+    TEST(Loop, Stop) {
+        control::Loop<Pressure>         loop(Time(1ms));
+        control::Proportional<Pressure> proportional(control::Gain<Pressure>(1.0f), Pressure(1.0f));
+
+        std::size_t ticks = 0;
+        loop.run(1000
+            , [] { return Pressure(0.0f); }
+            , [&](const control::Value<float>&) { if (++ticks == 5) { loop.stop(); } }
+            , proportional
+            );
+
+        EXPECT_EQ(5u, loop.timing().ticks);
+    }
+
+    TEST(Loop, Early) {
+        control::Loop<Pressure>         loop(Time(1ms));
+        control::Proportional<Pressure> proportional(control::Gain<Pressure>(1.0f), Pressure(1.0f));
+
+        std::size_t ticks = 0;
+        loop.stop();
+        loop.run(10
+            , [] { return Pressure(0.0f); }
+            , [&](const control::Value<float>&) { ticks++; }
+            , proportional
+            );
+        EXPECT_EQ(0u, ticks);
+        EXPECT_EQ(0u, loop.timing().ticks);
+
+        loop.run(10
+            , [] { return Pressure(0.0f); }
+            , [&](const control::Value<float>&) { ticks++; }
+            , proportional
+            );
+        EXPECT_EQ(10u, ticks);
+        EXPECT_EQ(10u, loop.timing().ticks);
+    }
+
+    TEST(Loop, Monitor) {
+        control::Loop<Pressure>         loop(Time(1ms));
+        control::Proportional<Pressure> proportional(control::Gain<Pressure>(1.0f), Pressure(1.0f));
+
+        std::atomic<bool> done(false);
+        std::thread monitor([&] {
+            std::uint64_t last = 0;
+            while (!done.load()) {
+                control::Timing timing = loop.timing();
+                EXPECT_GE(timing.ticks, last);
+                EXPECT_GE(timing.worst_jitter, timing.total_jitter / std::max<std::uint64_t>(timing.ticks, 1));
+                last = timing.ticks;
+            }
+        });
+        loop.run(50
+            , [] { return Pressure(0.0f); }
+            , [](const control::Value<float>&) {}
+            , proportional
+            );
+        done.store(true);
+        monitor.join();
+
+        EXPECT_EQ(50u, loop.timing().ticks);
+    }
+} // namespace f32
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
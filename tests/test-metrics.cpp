@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+#include <control/control.hpp>
+
+namespace rc {
+    template<typename Precision>
+    struct Arbitrary<ventilation::Pressure<Precision>> {
+        static Gen<ventilation::Pressure<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Pressure<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+} // namespace rc
+
+namespace f32 {
+    using Pressure  = ventilation::Pressure<float>;
+    using Metrics   = control::Metrics<float>;
+    using Time      = control::Time<float>;
+    using namespace std::chrono_literals;
+
+    TEST(Metrics, Step) {
+        std::vector<Pressure> response{
+            Pressure(5.0f), Pressure(15.0f), Pressure(22.0f), Pressure(21.0f), Pressure(20.1f), Pressure(20.0f),
+        };
+        Metrics metrics = control::evaluate<Pressure>(response, Pressure(5.0f), Pressure(20.0f), Time(1ms), 0.02f);
+        EXPECT_FLOAT_EQ(2.0f / 15.0f, metrics.overshoot);
+        EXPECT_FLOAT_EQ(4e-3f, metrics.settling.count());
+        EXPECT_FLOAT_EQ((15.0f + 5.0f + 2.0f + 1.0f + 0.1f) * 1e-3f, metrics.iae);
+    }
+
+    TEST(Metrics, Falling) {
+        std::vector<Pressure> response{Pressure(20.0f), Pressure(4.0f), Pressure(5.0f)};
+        Metrics metrics = control::evaluate<Pressure>(response, Pressure(20.0f), Pressure(5.0f), Time(1ms), 0.02f);
+        EXPECT_FLOAT_EQ(1.0f / 15.0f, metrics.overshoot);
+        EXPECT_FLOAT_EQ(2e-3f, metrics.settling.count());
+    }
+
+    RC_GTEST_PROP(Metrics, Settled, (const Pressure& xs)) {
+        std::vector<Pressure> response(100, xs);
+        Metrics metrics = control::evaluate<Pressure>(response, Pressure(0.0f), xs, Time(1ms), 0.02f);
+        RC_ASSERT(0.0f == metrics.overshoot);
+        RC_ASSERT(0.0f == metrics.settling.count());
+        RC_ASSERT(0.0f == metrics.iae);
+    }
+
+    TEST(Metrics, Mechanics) {
+        using Mechanics = control::Mechanics<float>;
+        auto simulate = [](const Mechanics& mechanics, float leak) {
+            control::Plant<float> plant(
+                control::Valve<float>(Time(10ms), 2.0f)
+                , control::Compartment<float>(mechanics, Pressure(5.0f))
+                , control::Leak<float>(leak)
+                );
+            control::PID<Pressure> controller(
+                control::Gain<Pressure>(0.5f)
+                , control::Gain<Pressure>(5.0e1f)
+                , control::Gain<Pressure>(3e-4f)
+                , Pressure(20.0f)
+                );
+            std::vector<Pressure> response(1000);
+            Pressure measured(5.0f);
+            for (Pressure& sample : response) {
+                sample      = plant(Pressure(controller(control::Process<Pressure>{measured, Time(1ms)})), Time(1ms)).pressure;
+                measured    = sample;
+            }
+            return control::evaluate<Pressure>(response, Pressure(5.0f), Pressure(20.0f), Time(1ms), 0.02f);
+        };
+
+        Metrics normal      = simulate(Mechanics{10.0f, 5.0e-2f}, 0.0f);
+        Metrics resistive   = simulate(Mechanics{50.0f, 5.0e-2f}, 0.0f);
+        Metrics compliant   = simulate(Mechanics{10.0f, 1.0e-1f}, 0.0f);
+        Metrics leaky       = simulate(Mechanics{10.0f, 5.0e-2f}, 5.0e-2f);
+        EXPECT_LT(resistive.iae, normal.iae - 1e-2f);
+        EXPECT_LT(resistive.overshoot, normal.overshoot - 1e-3f);
+        EXPECT_LT(compliant.overshoot, normal.overshoot - 1e-3f);
+        EXPECT_GT(leaky.iae, normal.iae + 1e-2f);
+        EXPECT_GT(leaky.settling.count(), normal.settling.count());
+    }
+
+    TEST(Summary, Merge) {
+        control::Summary<float> first;
+        control::Summary<float> second;
+        first.add(Metrics{0.1f, Time(10ms), 1.0f});
+        first.add(Metrics{0.3f, Time(30ms), 2.0f});
+        second.add(Metrics{0.2f, Time(50ms), 3.0f});
+        first.merge(second);
+
+        EXPECT_EQ(3u, first.count());
+        EXPECT_FLOAT_EQ(0.2f, first.mean().overshoot);
+        EXPECT_FLOAT_EQ(0.03f, first.mean().settling.count());
+        EXPECT_FLOAT_EQ(2.0f, first.mean().iae);
+        EXPECT_FLOAT_EQ(0.3f, first.worst().overshoot);
+        EXPECT_FLOAT_EQ(0.05f, first.worst().settling.count());
+        EXPECT_FLOAT_EQ(3.0f, first.worst().iae);
+    }
+} // namespace f32
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+#include <control/control.hpp>
+#include <thread>
+
+namespace rc {
+    template<typename Precision>
+    struct Arbitrary<ventilation::Pressure<Precision>> {
+        static Gen<ventilation::Pressure<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Pressure<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+} // namespace rc
+
+namespace f32 {
+    using Pressure      = ventilation::Pressure<float>;
+    using Process       = control::Process<Pressure>;
+    using Parameters    = control::Parameters<Pressure>;
+    using Time          = control::Time<float>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Retune, Integral, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>     kp(0.5f);
+        control::Gain<Pressure>     ki(5.0e1f);
+        control::Gain<Pressure>     kd(3e-4f);
+        control::PID<Pressure>      pid(kp, ki, kd, xs);
+        control::Integral<Pressure> integral(ki, xs);
+
+        Process process{0.5f * xs, duration};
+        for (std::size_t i = 0; i < 10; i++) {
+            pid(process);
+            integral(process);
+        }
+
+        Process steady{xs, duration};
+        pid(steady);
+        integral(steady);
+
+        Pressure before = pid(steady);
+        Pressure held   = static_cast<Pressure>(integral(steady));
+
+        control::Gain<Pressure> retuned(2.0e1f);
+        pid.retune(Parameters{kp, retuned, kd, xs});
+        integral.retune(retuned, xs);
+
+        RC_ASSERT(before == pid(steady));
+        RC_ASSERT(held == static_cast<Pressure>(integral(steady)));
+    }
+
+    RC_GTEST_PROP(Retune, Zero, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>     kp(0.5f);
+        control::Gain<Pressure>     ki(5.0e1f);
+        control::Gain<Pressure>     zero;
+        control::PID<Pressure>      pid(kp, ki, zero, xs);
+        control::Integral<Pressure> integral(ki, xs);
+
+        Process process{0.5f * xs, duration};
+        for (std::size_t i = 0; i < 10; i++) {
+            pid(process);
+            integral(process);
+        }
+
+        Process steady{xs, duration};
+        Pressure before = pid(steady);
+        Pressure held   = static_cast<Pressure>(integral(steady));
+
+        pid.retune(Parameters{kp, zero, zero, xs});
+        integral.retune(zero, xs);
+        RC_ASSERT(before == pid(steady));
+        RC_ASSERT(held == static_cast<Pressure>(integral(steady)));
+
+        pid.retune(Parameters{kp, ki, zero, xs});
+        integral.retune(ki, xs);
+        RC_ASSERT(before == pid(steady));
+        RC_ASSERT(held == static_cast<Pressure>(integral(steady)));
+    }
+
+    RC_GTEST_PROP(Retune, Target, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>         kd(3e-4f);
+        control::Differential<Pressure> differential(kd, Pressure(0.0f));
+        control::PID<Pressure>          pid(control::Gain<Pressure>(), control::Gain<Pressure>(), kd, Pressure(0.0f));
+
+        Process process{Pressure(0.0f), duration};
+        differential(process);
+        pid(process);
+
+        differential.retune(kd, xs);
+        pid.retune(Parameters{control::Gain<Pressure>(), control::Gain<Pressure>(), kd, xs});
+
+        RC_ASSERT(Pressure(0.0f) == static_cast<Pressure>(differential(process)));
+        RC_ASSERT(Pressure(0.0f) == pid(process));
+    }
+
+    TEST(Tunable, Threads) {
+        Time duration = 1ms;
+        control::Gain<Pressure> kp(1.0f);
+        control::Gain<Pressure> zero;
+        control::Tunable<Pressure, control::PID<Pressure>> tunable(
+                control::PID<Pressure>(kp, zero, zero, Pressure(0.0f)));
+
+        Process process{Pressure(0.0f), duration};
+        EXPECT_EQ(Pressure(0.0f), static_cast<Pressure>(tunable(process)));
+
+        std::thread publisher([&] {
+            tunable.publish(Parameters{kp, zero, zero, Pressure(10.0f)});
+        });
+        publisher.join();
+
+        EXPECT_EQ(Pressure(10.0f), static_cast<Pressure>(tunable(process)));
+        EXPECT_EQ(Pressure(10.0f), static_cast<Pressure>(tunable(process)));
+    }
+
+    TEST(Tunable, Terms) {
+        Time duration = 1ms;
+        control::Gain<Pressure> one(1.0f);
+        control::Gain<Pressure> two(2.0f);
+        control::Gain<Pressure> zero;
+        control::Tunable<Pressure, control::Proportional<Pressure>> proportional(
+                control::Proportional<Pressure>(one, Pressure(1.0f)));
+        control::Tunable<Pressure, control::Integral<Pressure>> integral(
+                control::Integral<Pressure>(one, Pressure(1.0f)));
+        control::Tunable<Pressure, control::Differential<Pressure>> differential(
+                control::Differential<Pressure>(one, Pressure(1.0f)));
+
+        Process process{Pressure(0.0f), duration};
+        EXPECT_EQ(Pressure(1.0f), static_cast<Pressure>(proportional(process)));
+        EXPECT_EQ(Pressure(1.0e-3f), static_cast<Pressure>(integral(process)));
+        differential(process);
+
+        proportional.publish(Parameters{two, zero, zero, Pressure(1.0f)});
+        integral.publish(Parameters{zero, two, zero, Pressure(1.0f)});
+        differential.publish(Parameters{zero, zero, two, Pressure(2.0f)});
+
+        EXPECT_EQ(Pressure(2.0f), static_cast<Pressure>(proportional(process)));
+        EXPECT_EQ(Pressure(3.0e-3f), static_cast<Pressure>(integral(process)));
+        EXPECT_EQ(Pressure(0.0f), static_cast<Pressure>(differential(process)));
+    }
+} // namespace f32
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,550 @@
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+#include <control/control.hpp>
+
+namespace rc {
+    template<typename Precision>
+    struct Arbitrary<ventilation::Flow<Precision>> {
+        static Gen<ventilation::Flow<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Flow<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::Pressure<Precision>> {
+        static Gen<ventilation::Pressure<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Pressure<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::PEEP<Precision>> {
+        static Gen<ventilation::PEEP<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::PEEP<Precision>>(
+                    gen::arbitrary<ventilation::Pressure<Precision>>()
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::Volume<Precision>> {
+        static Gen<ventilation::Volume<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Volume<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+} // namespace rc
+
+namespace f32 {
+    using Flow      = ventilation::Flow<float>;
+    using Pressure  = ventilation::Pressure<float>;
+    using Volume    = ventilation::Volume<float>;
+    using Time      = control::Time<float>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Integral, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>             gain(0.5f);
+        control::Integral<Flow>         variable(gain, xs);
+        control::PeriodicIntegral<Flow> periodic(gain, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = variable(process);
+            Flow actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Differential, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>                 gain(0.5f);
+        control::Differential<Flow>         variable(gain, xs);
+        control::PeriodicDifferential<Flow> periodic(gain, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = variable(process);
+            Flow actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(PID, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>        kp(0.5f);
+        control::Gain<Flow>        ki(5.0e1f);
+        control::Gain<Flow>        kd(3e-4f);
+        control::PID<Flow>         variable(kp, ki, kd, xs);
+        control::PeriodicPID<Flow> periodic(kp, ki, kd, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = variable(process);
+            Flow actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Integral, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>             gain(0.5f);
+        control::Integral<Pressure>         variable(gain, xs);
+        control::PeriodicIntegral<Pressure> periodic(gain, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = variable(process);
+            Pressure actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Differential, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>                 gain(0.5f);
+        control::Differential<Pressure>         variable(gain, xs);
+        control::PeriodicDifferential<Pressure> periodic(gain, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = variable(process);
+            Pressure actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(PID, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>        kp(0.5f);
+        control::Gain<Pressure>        ki(5.0e1f);
+        control::Gain<Pressure>        kd(3e-4f);
+        control::PID<Pressure>         variable(kp, ki, kd, xs);
+        control::PeriodicPID<Pressure> periodic(kp, ki, kd, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = variable(process);
+            Pressure actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Integral, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>             gain(0.5f);
+        control::Integral<Volume>         variable(gain, xs);
+        control::PeriodicIntegral<Volume> periodic(gain, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = variable(process);
+            Volume actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Differential, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>                 gain(0.5f);
+        control::Differential<Volume>         variable(gain, xs);
+        control::PeriodicDifferential<Volume> periodic(gain, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = variable(process);
+            Volume actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(PID, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>        kp(0.5f);
+        control::Gain<Volume>        ki(5.0e1f);
+        control::Gain<Volume>        kd(3e-4f);
+        control::PID<Volume>         variable(kp, ki, kd, xs);
+        control::PeriodicPID<Volume> periodic(kp, ki, kd, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = variable(process);
+            Volume actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+} // namespace f32
+namespace f64 {
+    using Flow      = ventilation::Flow<double>;
+    using Pressure  = ventilation::Pressure<double>;
+    using Volume    = ventilation::Volume<double>;
+    using Time      = control::Time<double>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Integral, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>             gain(0.5);
+        control::Integral<Flow>         variable(gain, xs);
+        control::PeriodicIntegral<Flow> periodic(gain, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = variable(process);
+            Flow actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Differential, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>                 gain(0.5);
+        control::Differential<Flow>         variable(gain, xs);
+        control::PeriodicDifferential<Flow> periodic(gain, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = variable(process);
+            Flow actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(PID, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>        kp(0.5);
+        control::Gain<Flow>        ki(5.0e1);
+        control::Gain<Flow>        kd(3e-4);
+        control::PID<Flow>         variable(kp, ki, kd, xs);
+        control::PeriodicPID<Flow> periodic(kp, ki, kd, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = variable(process);
+            Flow actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Integral, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>             gain(0.5);
+        control::Integral<Pressure>         variable(gain, xs);
+        control::PeriodicIntegral<Pressure> periodic(gain, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = variable(process);
+            Pressure actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Differential, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>                 gain(0.5);
+        control::Differential<Pressure>         variable(gain, xs);
+        control::PeriodicDifferential<Pressure> periodic(gain, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = variable(process);
+            Pressure actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(PID, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>        kp(0.5);
+        control::Gain<Pressure>        ki(5.0e1);
+        control::Gain<Pressure>        kd(3e-4);
+        control::PID<Pressure>         variable(kp, ki, kd, xs);
+        control::PeriodicPID<Pressure> periodic(kp, ki, kd, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = variable(process);
+            Pressure actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Integral, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>             gain(0.5);
+        control::Integral<Volume>         variable(gain, xs);
+        control::PeriodicIntegral<Volume> periodic(gain, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = variable(process);
+            Volume actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Differential, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>                 gain(0.5);
+        control::Differential<Volume>         variable(gain, xs);
+        control::PeriodicDifferential<Volume> periodic(gain, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = variable(process);
+            Volume actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(PID, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>        kp(0.5);
+        control::Gain<Volume>        ki(5.0e1);
+        control::Gain<Volume>        kd(3e-4);
+        control::PID<Volume>         variable(kp, ki, kd, xs);
+        control::PeriodicPID<Volume> periodic(kp, ki, kd, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = variable(process);
+            Volume actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+} // namespace f64
+namespace f128 {
+    using Flow      = ventilation::Flow<long double>;
+    using Pressure  = ventilation::Pressure<long double>;
+    using Volume    = ventilation::Volume<long double>;
+    using Time      = control::Time<long double>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Integral, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>             gain(0.5L);
+        control::Integral<Flow>         variable(gain, xs);
+        control::PeriodicIntegral<Flow> periodic(gain, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = variable(process);
+            Flow actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Differential, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>                 gain(0.5L);
+        control::Differential<Flow>         variable(gain, xs);
+        control::PeriodicDifferential<Flow> periodic(gain, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = variable(process);
+            Flow actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(PID, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>        kp(0.5L);
+        control::Gain<Flow>        ki(5.0e1L);
+        control::Gain<Flow>        kd(3e-4L);
+        control::PID<Flow>         variable(kp, ki, kd, xs);
+        control::PeriodicPID<Flow> periodic(kp, ki, kd, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = variable(process);
+            Flow actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Integral, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>             gain(0.5L);
+        control::Integral<Pressure>         variable(gain, xs);
+        control::PeriodicIntegral<Pressure> periodic(gain, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = variable(process);
+            Pressure actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Differential, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>                 gain(0.5L);
+        control::Differential<Pressure>         variable(gain, xs);
+        control::PeriodicDifferential<Pressure> periodic(gain, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = variable(process);
+            Pressure actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(PID, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>        kp(0.5L);
+        control::Gain<Pressure>        ki(5.0e1L);
+        control::Gain<Pressure>        kd(3e-4L);
+        control::PID<Pressure>         variable(kp, ki, kd, xs);
+        control::PeriodicPID<Pressure> periodic(kp, ki, kd, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = variable(process);
+            Pressure actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Integral, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>             gain(0.5L);
+        control::Integral<Volume>         variable(gain, xs);
+        control::PeriodicIntegral<Volume> periodic(gain, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = variable(process);
+            Volume actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Differential, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>                 gain(0.5L);
+        control::Differential<Volume>         variable(gain, xs);
+        control::PeriodicDifferential<Volume> periodic(gain, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = variable(process);
+            Volume actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(PID, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>        kp(0.5L);
+        control::Gain<Volume>        ki(5.0e1L);
+        control::Gain<Volume>        kd(3e-4L);
+        control::PID<Volume>         variable(kp, ki, kd, xs);
+        control::PeriodicPID<Volume> periodic(kp, ki, kd, xs, duration);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = variable(process);
+            Volume actual     = periodic(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+} // namespace f128
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,514 @@
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+#include <control/control.hpp>
+
+namespace rc {
+    template<typename Precision>
+    struct Arbitrary<ventilation::Flow<Precision>> {
+        static Gen<ventilation::Flow<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Flow<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::Pressure<Precision>> {
+        static Gen<ventilation::Pressure<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Pressure<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::PEEP<Precision>> {
+        static Gen<ventilation::PEEP<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::PEEP<Precision>>(
+                    gen::arbitrary<ventilation::Pressure<Precision>>()
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::Volume<Precision>> {
+        static Gen<ventilation::Volume<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Volume<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+} // namespace rc
+
+namespace f32 {
+    using Flow      = ventilation::Flow<float>;
+    using Pressure  = ventilation::Pressure<float>;
+    using Volume    = ventilation::Volume<float>;
+    using Time      = control::Time<float>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Terms, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>         kp(0.5f);
+        control::Gain<Flow>         ki(5.0e1f);
+        control::Gain<Flow>         kd(3e-4f);
+        control::PID<Flow>          pid(kp, ki, kd, xs);
+        control::Proportional<Flow> proportional(kp, xs);
+        control::Integral<Flow>     integral(ki, xs);
+        control::Differential<Flow> differential(kd, xs);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale     = static_cast<float>(i) / 100.0f;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = static_cast<Flow>(proportional(process))
+                            + static_cast<Flow>(integral(process))
+                            + static_cast<Flow>(differential(process));
+            Flow actual     = pid(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Terms, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>         kp(0.5f);
+        control::Gain<Pressure>         ki(5.0e1f);
+        control::Gain<Pressure>         kd(3e-4f);
+        control::PID<Pressure>          pid(kp, ki, kd, xs);
+        control::Proportional<Pressure> proportional(kp, xs);
+        control::Integral<Pressure>     integral(ki, xs);
+        control::Differential<Pressure> differential(kd, xs);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale         = static_cast<float>(i) / 100.0f;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = static_cast<Pressure>(proportional(process))
+                                + static_cast<Pressure>(integral(process))
+                                + static_cast<Pressure>(differential(process));
+            Pressure actual     = pid(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Terms, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>         kp(0.5f);
+        control::Gain<Volume>         ki(5.0e1f);
+        control::Gain<Volume>         kd(3e-4f);
+        control::PID<Volume>          pid(kp, ki, kd, xs);
+        control::Proportional<Volume> proportional(kp, xs);
+        control::Integral<Volume>     integral(ki, xs);
+        control::Differential<Volume> differential(kd, xs);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale       = static_cast<float>(i) / 100.0f;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = static_cast<Volume>(proportional(process))
+                              + static_cast<Volume>(integral(process))
+                              + static_cast<Volume>(differential(process));
+            Volume actual     = pid(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Batch, Flow, (const Flow& xs)) {
+        control::Gain<Flow> kp(0.5f);
+        control::Gain<Flow> ki(5.0e1f);
+        control::Gain<Flow> kd(3e-4f);
+        control::PID<Flow>  batched(kp, ki, kd, xs);
+        control::PID<Flow>  single(kp, ki, kd, xs);
+
+        std::vector<control::Process<Flow>> processes;
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            processes.push_back({scale * xs, Time(1ms)});
+        }
+
+        std::vector<control::Value<float>> output(processes.size());
+        std::span<const control::Process<Flow>> all(processes);
+        batched(all.first(50), std::span(output).first(50));
+        batched(all.subspan(50), std::span(output).subspan(50));
+
+        for (std::size_t i = 0; i < processes.size(); i++) {
+            Flow expected   = single(processes[i]);
+            Flow actual     = output[i];
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Batch, Pressure, (const Pressure& xs)) {
+        control::Gain<Pressure> kp(0.5f);
+        control::Gain<Pressure> ki(5.0e1f);
+        control::Gain<Pressure> kd(3e-4f);
+        control::PID<Pressure>  batched(kp, ki, kd, xs);
+        control::PID<Pressure>  single(kp, ki, kd, xs);
+
+        std::vector<control::Process<Pressure>> processes;
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            processes.push_back({scale * xs, Time(1ms)});
+        }
+
+        std::vector<control::Value<float>> output(processes.size());
+        std::span<const control::Process<Pressure>> all(processes);
+        batched(all.first(50), std::span(output).first(50));
+        batched(all.subspan(50), std::span(output).subspan(50));
+
+        for (std::size_t i = 0; i < processes.size(); i++) {
+            Pressure expected   = single(processes[i]);
+            Pressure actual     = output[i];
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Batch, Volume, (const Volume& xs)) {
+        control::Gain<Volume> kp(0.5f);
+        control::Gain<Volume> ki(5.0e1f);
+        control::Gain<Volume> kd(3e-4f);
+        control::PID<Volume>  batched(kp, ki, kd, xs);
+        control::PID<Volume>  single(kp, ki, kd, xs);
+
+        std::vector<control::Process<Volume>> processes;
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            processes.push_back({scale * xs, Time(1ms)});
+        }
+
+        std::vector<control::Value<float>> output(processes.size());
+        std::span<const control::Process<Volume>> all(processes);
+        batched(all.first(50), std::span(output).first(50));
+        batched(all.subspan(50), std::span(output).subspan(50));
+
+        for (std::size_t i = 0; i < processes.size(); i++) {
+            Volume expected   = single(processes[i]);
+            Volume actual     = output[i];
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+} // namespace f32
+namespace f64 {
+    using Flow      = ventilation::Flow<double>;
+    using Pressure  = ventilation::Pressure<double>;
+    using Volume    = ventilation::Volume<double>;
+    using Time      = control::Time<double>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Terms, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>         kp(0.5);
+        control::Gain<Flow>         ki(5.0e1);
+        control::Gain<Flow>         kd(3e-4);
+        control::PID<Flow>          pid(kp, ki, kd, xs);
+        control::Proportional<Flow> proportional(kp, xs);
+        control::Integral<Flow>     integral(ki, xs);
+        control::Differential<Flow> differential(kd, xs);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale     = static_cast<double>(i) / 100.0;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = static_cast<Flow>(proportional(process))
+                            + static_cast<Flow>(integral(process))
+                            + static_cast<Flow>(differential(process));
+            Flow actual     = pid(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Terms, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>         kp(0.5);
+        control::Gain<Pressure>         ki(5.0e1);
+        control::Gain<Pressure>         kd(3e-4);
+        control::PID<Pressure>          pid(kp, ki, kd, xs);
+        control::Proportional<Pressure> proportional(kp, xs);
+        control::Integral<Pressure>     integral(ki, xs);
+        control::Differential<Pressure> differential(kd, xs);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale         = static_cast<double>(i) / 100.0;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = static_cast<Pressure>(proportional(process))
+                                + static_cast<Pressure>(integral(process))
+                                + static_cast<Pressure>(differential(process));
+            Pressure actual     = pid(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Terms, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>         kp(0.5);
+        control::Gain<Volume>         ki(5.0e1);
+        control::Gain<Volume>         kd(3e-4);
+        control::PID<Volume>          pid(kp, ki, kd, xs);
+        control::Proportional<Volume> proportional(kp, xs);
+        control::Integral<Volume>     integral(ki, xs);
+        control::Differential<Volume> differential(kd, xs);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale       = static_cast<double>(i) / 100.0;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = static_cast<Volume>(proportional(process))
+                              + static_cast<Volume>(integral(process))
+                              + static_cast<Volume>(differential(process));
+            Volume actual     = pid(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Batch, Flow, (const Flow& xs)) {
+        control::Gain<Flow> kp(0.5);
+        control::Gain<Flow> ki(5.0e1);
+        control::Gain<Flow> kd(3e-4);
+        control::PID<Flow>  batched(kp, ki, kd, xs);
+        control::PID<Flow>  single(kp, ki, kd, xs);
+
+        std::vector<control::Process<Flow>> processes;
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            processes.push_back({scale * xs, Time(1ms)});
+        }
+
+        std::vector<control::Value<double>> output(processes.size());
+        std::span<const control::Process<Flow>> all(processes);
+        batched(all.first(50), std::span(output).first(50));
+        batched(all.subspan(50), std::span(output).subspan(50));
+
+        for (std::size_t i = 0; i < processes.size(); i++) {
+            Flow expected   = single(processes[i]);
+            Flow actual     = output[i];
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Batch, Pressure, (const Pressure& xs)) {
+        control::Gain<Pressure> kp(0.5);
+        control::Gain<Pressure> ki(5.0e1);
+        control::Gain<Pressure> kd(3e-4);
+        control::PID<Pressure>  batched(kp, ki, kd, xs);
+        control::PID<Pressure>  single(kp, ki, kd, xs);
+
+        std::vector<control::Process<Pressure>> processes;
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            processes.push_back({scale * xs, Time(1ms)});
+        }
+
+        std::vector<control::Value<double>> output(processes.size());
+        std::span<const control::Process<Pressure>> all(processes);
+        batched(all.first(50), std::span(output).first(50));
+        batched(all.subspan(50), std::span(output).subspan(50));
+
+        for (std::size_t i = 0; i < processes.size(); i++) {
+            Pressure expected   = single(processes[i]);
+            Pressure actual     = output[i];
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Batch, Volume, (const Volume& xs)) {
+        control::Gain<Volume> kp(0.5);
+        control::Gain<Volume> ki(5.0e1);
+        control::Gain<Volume> kd(3e-4);
+        control::PID<Volume>  batched(kp, ki, kd, xs);
+        control::PID<Volume>  single(kp, ki, kd, xs);
+
+        std::vector<control::Process<Volume>> processes;
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale = static_cast<double>(i) / 100.0;
+            processes.push_back({scale * xs, Time(1ms)});
+        }
+
+        std::vector<control::Value<double>> output(processes.size());
+        std::span<const control::Process<Volume>> all(processes);
+        batched(all.first(50), std::span(output).first(50));
+        batched(all.subspan(50), std::span(output).subspan(50));
+
+        for (std::size_t i = 0; i < processes.size(); i++) {
+            Volume expected   = single(processes[i]);
+            Volume actual     = output[i];
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+} // namespace f64
+namespace f128 {
+    using Flow      = ventilation::Flow<long double>;
+    using Pressure  = ventilation::Pressure<long double>;
+    using Volume    = ventilation::Volume<long double>;
+    using Time      = control::Time<long double>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Terms, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        control::Gain<Flow>         kp(0.5L);
+        control::Gain<Flow>         ki(5.0e1L);
+        control::Gain<Flow>         kd(3e-4L);
+        control::PID<Flow>          pid(kp, ki, kd, xs);
+        control::Proportional<Flow> proportional(kp, xs);
+        control::Integral<Flow>     integral(ki, xs);
+        control::Differential<Flow> differential(kd, xs);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale     = static_cast<long double>(i) / 100.0L;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = static_cast<Flow>(proportional(process))
+                            + static_cast<Flow>(integral(process))
+                            + static_cast<Flow>(differential(process));
+            Flow actual     = pid(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Terms, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>         kp(0.5L);
+        control::Gain<Pressure>         ki(5.0e1L);
+        control::Gain<Pressure>         kd(3e-4L);
+        control::PID<Pressure>          pid(kp, ki, kd, xs);
+        control::Proportional<Pressure> proportional(kp, xs);
+        control::Integral<Pressure>     integral(ki, xs);
+        control::Differential<Pressure> differential(kd, xs);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale         = static_cast<long double>(i) / 100.0L;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = static_cast<Pressure>(proportional(process))
+                                + static_cast<Pressure>(integral(process))
+                                + static_cast<Pressure>(differential(process));
+            Pressure actual     = pid(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Terms, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        control::Gain<Volume>         kp(0.5L);
+        control::Gain<Volume>         ki(5.0e1L);
+        control::Gain<Volume>         kd(3e-4L);
+        control::PID<Volume>          pid(kp, ki, kd, xs);
+        control::Proportional<Volume> proportional(kp, xs);
+        control::Integral<Volume>     integral(ki, xs);
+        control::Differential<Volume> differential(kd, xs);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale       = static_cast<long double>(i) / 100.0L;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = static_cast<Volume>(proportional(process))
+                              + static_cast<Volume>(integral(process))
+                              + static_cast<Volume>(differential(process));
+            Volume actual     = pid(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Batch, Flow, (const Flow& xs)) {
+        control::Gain<Flow> kp(0.5L);
+        control::Gain<Flow> ki(5.0e1L);
+        control::Gain<Flow> kd(3e-4L);
+        control::PID<Flow>  batched(kp, ki, kd, xs);
+        control::PID<Flow>  single(kp, ki, kd, xs);
+
+        std::vector<control::Process<Flow>> processes;
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            processes.push_back({scale * xs, Time(1ms)});
+        }
+
+        std::vector<control::Value<long double>> output(processes.size());
+        std::span<const control::Process<Flow>> all(processes);
+        batched(all.first(50), std::span(output).first(50));
+        batched(all.subspan(50), std::span(output).subspan(50));
+
+        for (std::size_t i = 0; i < processes.size(); i++) {
+            Flow expected   = single(processes[i]);
+            Flow actual     = output[i];
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Batch, Pressure, (const Pressure& xs)) {
+        control::Gain<Pressure> kp(0.5L);
+        control::Gain<Pressure> ki(5.0e1L);
+        control::Gain<Pressure> kd(3e-4L);
+        control::PID<Pressure>  batched(kp, ki, kd, xs);
+        control::PID<Pressure>  single(kp, ki, kd, xs);
+
+        std::vector<control::Process<Pressure>> processes;
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            processes.push_back({scale * xs, Time(1ms)});
+        }
+
+        std::vector<control::Value<long double>> output(processes.size());
+        std::span<const control::Process<Pressure>> all(processes);
+        batched(all.first(50), std::span(output).first(50));
+        batched(all.subspan(50), std::span(output).subspan(50));
+
+        for (std::size_t i = 0; i < processes.size(); i++) {
+            Pressure expected   = single(processes[i]);
+            Pressure actual     = output[i];
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Batch, Volume, (const Volume& xs)) {
+        control::Gain<Volume> kp(0.5L);
+        control::Gain<Volume> ki(5.0e1L);
+        control::Gain<Volume> kd(3e-4L);
+        control::PID<Volume>  batched(kp, ki, kd, xs);
+        control::PID<Volume>  single(kp, ki, kd, xs);
+
+        std::vector<control::Process<Volume>> processes;
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale = static_cast<long double>(i) / 100.0L;
+            processes.push_back({scale * xs, Time(1ms)});
+        }
+
+        std::vector<control::Value<long double>> output(processes.size());
+        std::span<const control::Process<Volume>> all(processes);
+        batched(all.first(50), std::span(output).first(50));
+        batched(all.subspan(50), std::span(output).subspan(50));
+
+        for (std::size_t i = 0; i < processes.size(); i++) {
+            Volume expected   = single(processes[i]);
+            Volume actual     = output[i];
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+} // namespace f128
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
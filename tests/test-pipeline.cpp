@@ -0,0 +1,440 @@
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+#include <control/control.hpp>
+
+namespace rc {
+    template<typename Precision>
+    struct Arbitrary<ventilation::Flow<Precision>> {
+        static Gen<ventilation::Flow<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Flow<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::Pressure<Precision>> {
+        static Gen<ventilation::Pressure<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Pressure<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::PEEP<Precision>> {
+        static Gen<ventilation::PEEP<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::PEEP<Precision>>(
+                    gen::arbitrary<ventilation::Pressure<Precision>>()
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::Volume<Precision>> {
+        static Gen<ventilation::Volume<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Volume<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+} // namespace rc
+
+template <typename Target>
+struct Bias {
+    using Precision = typename ventilation::precision<Target>::type;
+    Target offset;
+
+    control::Value<Precision>
+    operator()(const control::Process<Target>&) const {
+        return control::Value<Precision>(offset);
+    }
+};
+
+static_assert(control::Term<Bias<ventilation::Flow<float>>, ventilation::Flow<float>>);
+static_assert(control::Term<control::PID<ventilation::Flow<float>>, ventilation::Flow<float>>);
+static_assert(!control::Term<Bias<ventilation::Flow<float>>, ventilation::Volume<float>>);
+static_assert(!control::Term<int, ventilation::Flow<float>>);
+
+namespace f32 {
+    using Flow      = ventilation::Flow<float>;
+    using Pressure  = ventilation::Pressure<float>;
+    using Volume    = ventilation::Volume<float>;
+    using Time      = control::Time<float>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Terms, Flow, (const Flow& xs)) {
+        using Pipeline = control::Pipeline<Flow
+            , control::Proportional<Flow>
+            , control::Integral<Flow>
+            , control::Differential<Flow>
+            >;
+        Time duration = 1ms;
+        control::Gain<Flow> kp(0.5f);
+        control::Gain<Flow> ki(5.0e1f);
+        control::Gain<Flow> kd(3e-4f);
+        control::PID<Flow>  pid(kp, ki, kd, xs);
+        Pipeline            pipeline(
+              control::Proportional<Flow>(kp, xs)
+            , control::Integral<Flow>(ki, xs)
+            , control::Differential<Flow>(kd, xs)
+            );
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale     = static_cast<float>(i) / 100.0f;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = pid(process);
+            Flow actual     = pipeline(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Bias, Flow, (const Flow& xs)) {
+        control::Gain<Flow> kp(1.0f);
+        control::Pipeline<Flow, control::Proportional<Flow>, Bias<Flow>> pipeline(
+              control::Proportional<Flow>(kp, xs)
+            , Bias<Flow>{xs}
+            );
+        control::Process<Flow> process{Flow(0.0f), Time(1ms)};
+
+        RC_ASSERT((2.0f * xs) == pipeline(process));
+    }
+
+    RC_GTEST_PROP(Terms, Pressure, (const Pressure& xs)) {
+        using Pipeline = control::Pipeline<Pressure
+            , control::Proportional<Pressure>
+            , control::Integral<Pressure>
+            , control::Differential<Pressure>
+            >;
+        Time duration = 1ms;
+        control::Gain<Pressure> kp(0.5f);
+        control::Gain<Pressure> ki(5.0e1f);
+        control::Gain<Pressure> kd(3e-4f);
+        control::PID<Pressure>  pid(kp, ki, kd, xs);
+        Pipeline                pipeline(
+              control::Proportional<Pressure>(kp, xs)
+            , control::Integral<Pressure>(ki, xs)
+            , control::Differential<Pressure>(kd, xs)
+            );
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale         = static_cast<float>(i) / 100.0f;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = pid(process);
+            Pressure actual     = pipeline(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Bias, Pressure, (const Pressure& xs)) {
+        control::Gain<Pressure> kp(1.0f);
+        control::Pipeline<Pressure, control::Proportional<Pressure>, Bias<Pressure>> pipeline(
+              control::Proportional<Pressure>(kp, xs)
+            , Bias<Pressure>{xs}
+            );
+        control::Process<Pressure> process{Pressure(0.0f), Time(1ms)};
+
+        RC_ASSERT((2.0f * xs) == pipeline(process));
+    }
+
+    RC_GTEST_PROP(Terms, Volume, (const Volume& xs)) {
+        using Pipeline = control::Pipeline<Volume
+            , control::Proportional<Volume>
+            , control::Integral<Volume>
+            , control::Differential<Volume>
+            >;
+        Time duration = 1ms;
+        control::Gain<Volume> kp(0.5f);
+        control::Gain<Volume> ki(5.0e1f);
+        control::Gain<Volume> kd(3e-4f);
+        control::PID<Volume>  pid(kp, ki, kd, xs);
+        Pipeline              pipeline(
+              control::Proportional<Volume>(kp, xs)
+            , control::Integral<Volume>(ki, xs)
+            , control::Differential<Volume>(kd, xs)
+            );
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale       = static_cast<float>(i) / 100.0f;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = pid(process);
+            Volume actual     = pipeline(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Bias, Volume, (const Volume& xs)) {
+        control::Gain<Volume> kp(1.0f);
+        control::Pipeline<Volume, control::Proportional<Volume>, Bias<Volume>> pipeline(
+              control::Proportional<Volume>(kp, xs)
+            , Bias<Volume>{xs}
+            );
+        control::Process<Volume> process{Volume(0.0f), Time(1ms)};
+
+        RC_ASSERT((2.0f * xs) == pipeline(process));
+    }
+} // namespace f32
+namespace f64 {
+    using Flow      = ventilation::Flow<double>;
+    using Pressure  = ventilation::Pressure<double>;
+    using Volume    = ventilation::Volume<double>;
+    using Time      = control::Time<double>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Terms, Flow, (const Flow& xs)) {
+        using Pipeline = control::Pipeline<Flow
+            , control::Proportional<Flow>
+            , control::Integral<Flow>
+            , control::Differential<Flow>
+            >;
+        Time duration = 1ms;
+        control::Gain<Flow> kp(0.5);
+        control::Gain<Flow> ki(5.0e1);
+        control::Gain<Flow> kd(3e-4);
+        control::PID<Flow>  pid(kp, ki, kd, xs);
+        Pipeline            pipeline(
+              control::Proportional<Flow>(kp, xs)
+            , control::Integral<Flow>(ki, xs)
+            , control::Differential<Flow>(kd, xs)
+            );
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale     = static_cast<double>(i) / 100.0;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = pid(process);
+            Flow actual     = pipeline(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Bias, Flow, (const Flow& xs)) {
+        control::Gain<Flow> kp(1.0);
+        control::Pipeline<Flow, control::Proportional<Flow>, Bias<Flow>> pipeline(
+              control::Proportional<Flow>(kp, xs)
+            , Bias<Flow>{xs}
+            );
+        control::Process<Flow> process{Flow(0.0), Time(1ms)};
+
+        RC_ASSERT((2.0 * xs) == pipeline(process));
+    }
+
+    RC_GTEST_PROP(Terms, Pressure, (const Pressure& xs)) {
+        using Pipeline = control::Pipeline<Pressure
+            , control::Proportional<Pressure>
+            , control::Integral<Pressure>
+            , control::Differential<Pressure>
+            >;
+        Time duration = 1ms;
+        control::Gain<Pressure> kp(0.5);
+        control::Gain<Pressure> ki(5.0e1);
+        control::Gain<Pressure> kd(3e-4);
+        control::PID<Pressure>  pid(kp, ki, kd, xs);
+        Pipeline                pipeline(
+              control::Proportional<Pressure>(kp, xs)
+            , control::Integral<Pressure>(ki, xs)
+            , control::Differential<Pressure>(kd, xs)
+            );
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale         = static_cast<double>(i) / 100.0;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = pid(process);
+            Pressure actual     = pipeline(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Bias, Pressure, (const Pressure& xs)) {
+        control::Gain<Pressure> kp(1.0);
+        control::Pipeline<Pressure, control::Proportional<Pressure>, Bias<Pressure>> pipeline(
+              control::Proportional<Pressure>(kp, xs)
+            , Bias<Pressure>{xs}
+            );
+        control::Process<Pressure> process{Pressure(0.0), Time(1ms)};
+
+        RC_ASSERT((2.0 * xs) == pipeline(process));
+    }
+
+    RC_GTEST_PROP(Terms, Volume, (const Volume& xs)) {
+        using Pipeline = control::Pipeline<Volume
+            , control::Proportional<Volume>
+            , control::Integral<Volume>
+            , control::Differential<Volume>
+            >;
+        Time duration = 1ms;
+        control::Gain<Volume> kp(0.5);
+        control::Gain<Volume> ki(5.0e1);
+        control::Gain<Volume> kd(3e-4);
+        control::PID<Volume>  pid(kp, ki, kd, xs);
+        Pipeline              pipeline(
+              control::Proportional<Volume>(kp, xs)
+            , control::Integral<Volume>(ki, xs)
+            , control::Differential<Volume>(kd, xs)
+            );
+
+        for (std::size_t i = 0; i < 100; i++) {
+            double scale       = static_cast<double>(i) / 100.0;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = pid(process);
+            Volume actual     = pipeline(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Bias, Volume, (const Volume& xs)) {
+        control::Gain<Volume> kp(1.0);
+        control::Pipeline<Volume, control::Proportional<Volume>, Bias<Volume>> pipeline(
+              control::Proportional<Volume>(kp, xs)
+            , Bias<Volume>{xs}
+            );
+        control::Process<Volume> process{Volume(0.0), Time(1ms)};
+
+        RC_ASSERT((2.0 * xs) == pipeline(process));
+    }
+} // namespace f64
+namespace f128 {
+    using Flow      = ventilation::Flow<long double>;
+    using Pressure  = ventilation::Pressure<long double>;
+    using Volume    = ventilation::Volume<long double>;
+    using Time      = control::Time<long double>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Terms, Flow, (const Flow& xs)) {
+        using Pipeline = control::Pipeline<Flow
+            , control::Proportional<Flow>
+            , control::Integral<Flow>
+            , control::Differential<Flow>
+            >;
+        Time duration = 1ms;
+        control::Gain<Flow> kp(0.5L);
+        control::Gain<Flow> ki(5.0e1L);
+        control::Gain<Flow> kd(3e-4L);
+        control::PID<Flow>  pid(kp, ki, kd, xs);
+        Pipeline            pipeline(
+              control::Proportional<Flow>(kp, xs)
+            , control::Integral<Flow>(ki, xs)
+            , control::Differential<Flow>(kd, xs)
+            );
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale     = static_cast<long double>(i) / 100.0L;
+            control::Process<Flow> process{scale * xs, duration};
+
+            Flow expected   = pid(process);
+            Flow actual     = pipeline(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Bias, Flow, (const Flow& xs)) {
+        control::Gain<Flow> kp(1.0L);
+        control::Pipeline<Flow, control::Proportional<Flow>, Bias<Flow>> pipeline(
+              control::Proportional<Flow>(kp, xs)
+            , Bias<Flow>{xs}
+            );
+        control::Process<Flow> process{Flow(0.0L), Time(1ms)};
+
+        RC_ASSERT((2.0L * xs) == pipeline(process));
+    }
+
+    RC_GTEST_PROP(Terms, Pressure, (const Pressure& xs)) {
+        using Pipeline = control::Pipeline<Pressure
+            , control::Proportional<Pressure>
+            , control::Integral<Pressure>
+            , control::Differential<Pressure>
+            >;
+        Time duration = 1ms;
+        control::Gain<Pressure> kp(0.5L);
+        control::Gain<Pressure> ki(5.0e1L);
+        control::Gain<Pressure> kd(3e-4L);
+        control::PID<Pressure>  pid(kp, ki, kd, xs);
+        Pipeline                pipeline(
+              control::Proportional<Pressure>(kp, xs)
+            , control::Integral<Pressure>(ki, xs)
+            , control::Differential<Pressure>(kd, xs)
+            );
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale         = static_cast<long double>(i) / 100.0L;
+            control::Process<Pressure> process{scale * xs, duration};
+
+            Pressure expected   = pid(process);
+            Pressure actual     = pipeline(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Bias, Pressure, (const Pressure& xs)) {
+        control::Gain<Pressure> kp(1.0L);
+        control::Pipeline<Pressure, control::Proportional<Pressure>, Bias<Pressure>> pipeline(
+              control::Proportional<Pressure>(kp, xs)
+            , Bias<Pressure>{xs}
+            );
+        control::Process<Pressure> process{Pressure(0.0L), Time(1ms)};
+
+        RC_ASSERT((2.0L * xs) == pipeline(process));
+    }
+
+    RC_GTEST_PROP(Terms, Volume, (const Volume& xs)) {
+        using Pipeline = control::Pipeline<Volume
+            , control::Proportional<Volume>
+            , control::Integral<Volume>
+            , control::Differential<Volume>
+            >;
+        Time duration = 1ms;
+        control::Gain<Volume> kp(0.5L);
+        control::Gain<Volume> ki(5.0e1L);
+        control::Gain<Volume> kd(3e-4L);
+        control::PID<Volume>  pid(kp, ki, kd, xs);
+        Pipeline              pipeline(
+              control::Proportional<Volume>(kp, xs)
+            , control::Integral<Volume>(ki, xs)
+            , control::Differential<Volume>(kd, xs)
+            );
+
+        for (std::size_t i = 0; i < 100; i++) {
+            long double scale       = static_cast<long double>(i) / 100.0L;
+            control::Process<Volume> process{scale * xs, duration};
+
+            Volume expected   = pid(process);
+            Volume actual     = pipeline(process);
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+
+    RC_GTEST_PROP(Bias, Volume, (const Volume& xs)) {
+        control::Gain<Volume> kp(1.0L);
+        control::Pipeline<Volume, control::Proportional<Volume>, Bias<Volume>> pipeline(
+              control::Proportional<Volume>(kp, xs)
+            , Bias<Volume>{xs}
+            );
+        control::Process<Volume> process{Volume(0.0L), Time(1ms)};
+
+        RC_ASSERT((2.0L * xs) == pipeline(process));
+    }
+} // namespace f128
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+#include <control/control.hpp>
+
+namespace rc {
+    template<typename Precision>
+    struct Arbitrary<ventilation::Pressure<Precision>> {
+        static Gen<ventilation::Pressure<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Pressure<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+} // namespace rc
+
+namespace f32 {
+    using Pressure      = ventilation::Pressure<float>;
+    using Flow          = ventilation::Flow<float>;
+    using Volume        = ventilation::Volume<float>;
+    using Airway        = control::Airway<float>;
+    using Mechanics     = control::Mechanics<float>;
+    using Time          = control::Time<float>;
+    using namespace std::chrono_literals;
+
+    TEST(Valve, Lag) {
+        control::Valve<float> valve(Time(10ms), 1.0f);
+        Pressure pressure;
+        for (std::size_t i = 0; i < 10; i++) {
+            pressure = valve(Pressure(10.0f), Time(1ms));
+        }
+        EXPECT_NEAR(6.3f, static_cast<float>(pressure), 0.3f);
+        for (std::size_t i = 0; i < 1000; i++) {
+            pressure = valve(Pressure(10.0f), Time(1ms));
+        }
+        EXPECT_EQ(Pressure(10.0f), pressure);
+    }
+
+    TEST(Compartment, Steady) {
+        control::Compartment<float> lung(Mechanics{10.0f, 5.0e-2f}, Pressure(5.0f));
+        Airway airway{};
+        for (std::size_t i = 0; i < 500; i++) {
+            airway = lung(Pressure(25.0f), Time(1ms));
+        }
+        EXPECT_NEAR(0.632f, static_cast<float>(airway.volume), 0.01f);
+        for (std::size_t i = 0; i < 5000; i++) {
+            airway = lung(Pressure(25.0f), Time(1ms));
+        }
+        EXPECT_EQ(Volume(1.0f), airway.volume);
+        EXPECT_NEAR(0.0f, static_cast<float>(airway.flow), 1e-3f);
+    }
+
+    TEST(Compartment, Stiff) {
+        control::Compartment<float> lung(Mechanics{1.0f, 1.0e-4f}, Pressure(0.0f));
+        Airway airway{};
+        for (std::size_t i = 0; i < 100; i++) {
+            airway = lung(Pressure(10.0f), Time(10ms));
+        }
+        EXPECT_EQ(Volume(1.0e-3f), airway.volume);
+    }
+
+    RC_GTEST_PROP(TwoCompartment, Parallel, (const Pressure& xs)) {
+        Mechanics branch{10.0f, 5.0e-2f};
+        control::TwoCompartment<float> two(branch, branch, Pressure(5.0f));
+        control::Compartment<float> one(Mechanics{5.0f, 1.0e-1f}, Pressure(5.0f));
+        for (std::size_t i = 0; i < 100; i++) {
+            Airway expected = one(xs, Time(1ms));
+            Airway actual   = two(xs, Time(1ms));
+            RC_ASSERT(expected.flow == actual.flow);
+            RC_ASSERT(expected.volume == actual.volume);
+        }
+    }
+
+    TEST(Plant, Leak) {
+        control::Plant<float> plant(
+            control::Valve<float>(Time(5ms), 1.0f)
+            , control::Compartment<float>(Mechanics{10.0f, 5.0e-2f}, Pressure(0.0f))
+            , control::Leak<float>(0.1f)
+            );
+        Airway airway{};
+        for (std::size_t i = 0; i < 10000; i++) {
+            airway = plant(Pressure(20.0f), Time(1ms));
+        }
+        EXPECT_NEAR(20.0f / 1.1f, static_cast<float>(airway.pressure), 1e-3f);
+        EXPECT_NEAR(2.0f / 1.1f, static_cast<float>(airway.flow), 1e-3f);
+    }
+
+    TEST(Plant, Motion) {
+        Mechanics mechanics{10.0f, 5.0e-2f};
+        control::Plant<float> plant(
+            control::Valve<float>(Time(5ms), 2.0f)
+            , control::Compartment<float>(mechanics, Pressure(5.0f))
+            , control::Leak<float>(0.05f)
+            );
+        for (std::size_t i = 0; i < 200; i++) {
+            Airway airway   = plant(Pressure(20.0f), Time(1ms));
+            float pressure  = static_cast<float>(airway.pressure);
+            float inflow    = static_cast<float>(airway.flow) - 0.05f * pressure;
+            float expected  = 5.0f + static_cast<float>(airway.volume) / mechanics.compliance + mechanics.resistance * inflow;
+            EXPECT_NEAR(expected, pressure, 1e-3f);
+        }
+    }
+
+    TEST(Plant, Mechanics) {
+        auto response = [](const Mechanics& mechanics, float leak) {
+            control::Plant<float> plant(
+                control::Valve<float>(Time(5ms), 2.0f)
+                , control::Compartment<float>(mechanics, Pressure(5.0f))
+                , control::Leak<float>(leak)
+                );
+            std::vector<float> trace(50);
+            for (float& sample : trace) {
+                sample = static_cast<float>(plant(Pressure(20.0f), Time(1ms)).pressure);
+            }
+            return trace;
+        };
+
+        std::vector<float> normal       = response(Mechanics{10.0f, 5.0e-2f}, 0.0f);
+        std::vector<float> resistive    = response(Mechanics{50.0f, 5.0e-2f}, 0.0f);
+        std::vector<float> stiff        = response(Mechanics{10.0f, 1.0e-2f}, 0.0f);
+        std::vector<float> leaky        = response(Mechanics{10.0f, 5.0e-2f}, 0.2f);
+        for (std::size_t i = 10; i < normal.size(); i++) {
+            EXPECT_GT(resistive[i], normal[i] + 1e-2f);
+            EXPECT_GT(stiff[i], normal[i] + 1e-2f);
+            EXPECT_LT(leaky[i], normal[i] - 1e-2f);
+        }
+    }
+
+    RC_GTEST_PROP(Cohort, Dynamic, (const std::vector<Pressure>& xs)) {
+        control::Cohort<float>              cohort(xs.size());
+        std::vector<control::Plant<float>>  plants;
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            float scale = static_cast<float>(c + 1);
+            Mechanics mechanics{5.0f * scale, 2.0e-2f * scale};
+            cohort.assign(c, mechanics, Pressure(5.0f), Time(1ms * scale), 0.5f * scale, 0.01f * scale);
+            plants.emplace_back(
+                control::Valve<float>(Time(1ms * scale), 0.5f * scale)
+                , control::Compartment<float>(mechanics, Pressure(5.0f))
+                , control::Leak<float>(0.01f * scale)
+                );
+        }
+
+        std::vector<Airway> output(xs.size());
+        for (std::size_t i = 0; i < 100; i++) {
+            cohort(xs, Time(1ms), output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                Airway expected = plants[c](xs[c], Time(1ms));
+                RC_ASSERT(expected.pressure == output[c].pressure);
+                RC_ASSERT(expected.flow == output[c].flow);
+                RC_ASSERT(expected.volume == output[c].volume);
+            }
+        }
+    }
+
+    RC_GTEST_PROP(Cohort, Fixed, (const std::array<Pressure, 8>& xs)) {
+        control::Cohort<float, 8>           cohort;
+        std::vector<control::Plant<float>>  plants;
+        for (std::size_t c = 0; c < xs.size(); c++) {
+            Mechanics mechanics{10.0f, 5.0e-2f};
+            cohort.assign(c, mechanics, Pressure(0.0f), Time(10ms), 2.0f, 0.0f);
+            plants.emplace_back(
+                control::Valve<float>(Time(10ms), 2.0f)
+                , control::Compartment<float>(mechanics, Pressure(0.0f))
+                , control::Leak<float>(0.0f)
+                );
+        }
+
+        std::array<Airway, 8> output{};
+        for (std::size_t i = 0; i < 100; i++) {
+            cohort(xs, Time(1ms), output);
+            for (std::size_t c = 0; c < xs.size(); c++) {
+                Airway expected = plants[c](xs[c], Time(1ms));
+                RC_ASSERT(expected.volume == output[c].volume);
+            }
+        }
+    }
+} // namespace f32
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+#include <control/control.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace f32 {
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Pool, Once, (const std::vector<int>& xs)) {
+        control::Pool pool(4);
+        std::vector<std::atomic<int>> visits(xs.size());
+        std::atomic<std::size_t> highest = 0;
+        pool(xs.size(), [&](std::size_t index, std::size_t worker) {
+            visits[index].fetch_add(1);
+            highest.store(std::max(highest.load(), worker));
+        });
+
+        RC_ASSERT(highest.load() < pool.size());
+        for (const std::atomic<int>& visit : visits) {
+            RC_ASSERT(1 == visit.load());
+        }
+    }
+
+    TEST(Pool, Repeated) {
+        control::Pool pool(3);
+        std::atomic<std::size_t> total = 0;
+        for (std::size_t batch = 0; batch < 100; batch++) {
+            pool(batch, [&](std::size_t index, std::size_t) {
+                total.fetch_add(index);
+            });
+        }
+
+        std::size_t expected = 0;
+        for (std::size_t batch = 0; batch < 100; batch++) {
+            expected += batch * (batch - 1) / 2;
+        }
+        EXPECT_EQ(expected, total.load());
+    }
+
+    TEST(Pool, Steal) {
+        control::Pool pool(4);
+        std::vector<std::size_t> owner(64);
+        pool(owner.size(), [&](std::size_t index, std::size_t worker) {
+            if (index == 0) {
+                std::this_thread::sleep_for(50ms);
+            }
+            owner[index] = worker;
+        });
+
+        std::size_t stolen = 0;
+        for (std::size_t index = 1; index < owner.size() / 4; index++) {
+            stolen += owner[index] != 0 ? 1 : 0;
+        }
+        EXPECT_LT(0u, stolen);
+    }
+
+    TEST(Pool, Single) {
+        control::Pool pool(1);
+        std::size_t total = 0;
+        pool(10, [&](std::size_t index, std::size_t worker) {
+            EXPECT_EQ(0u, worker);
+            total += index;
+        });
+        EXPECT_EQ(45u, total);
+    }
+} // namespace f32
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+#include <control/control.hpp>
+#include <control/control-loop.hpp>
+#include <control/control-replay.hpp>
+#include <control/control-trace.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace f32 {
+    using Pressure  = ventilation::Pressure<float>;
+    using Process   = control::Process<Pressure>;
+    using Gain      = control::Gain<Pressure>;
+    using PID       = control::PID<Pressure>;
+    using Record    = control::trace::Record<float>;
+    using Time      = control::Time<float>;
+    using namespace std::chrono_literals;
+
+    const std::vector<Record>&
+    session() {
+        static const std::vector<Record> records = [] {
+            PID controller(Gain(0.5f), Gain(5.0e1f), Gain(3e-4f), Pressure(0.0f));
+            auto trajectory = control::Trajectory<Pressure>::square(Pressure(5.0f), Pressure(20.0f), Time(20ms), Time(100us), 0.4f);
+            control::Loop<Pressure> loop(Time(100us));
+
+            std::vector<Record> recorded;
+            Pressure measurement(5.0f);
+            auto traced = [&](const Process& process) {
+                std::uint64_t timestamp = static_cast<std::uint64_t>(
+                    std::chrono::steady_clock::now().time_since_epoch() / std::chrono::nanoseconds(1));
+                const Pressure& target  = trajectory();
+                Pressure output         = controller(process, target);
+                recorded.push_back(Record{timestamp, 0, 0, process.duration.count()
+                    , static_cast<float>(process.measurement), static_cast<float>(target), 0.0f, 0.0f, 0.0f
+                    , static_cast<float>(output), 0.0f});
+                recorded.push_back(Record{timestamp, 1, 0, 0.0f, -1.0f, -1.0f, 0.0f, 0.0f, 0.0f, -1.0f, 0.0f});
+                return control::Value<float>(output);
+            };
+
+            loop.run(5000
+                , [&] { return measurement; }
+                , [&](const control::Value<float>& output) { measurement = measurement + Pressure(1e-3f * static_cast<float>(Pressure(output))); }
+                , traced
+                );
+            return recorded;
+        }();
+        return records;
+    }
+
+    std::span<const Record>
+    session(std::size_t samples) {
+        return std::span<const Record>(session()).first(2 * samples);
+    }
+
+    std::vector<PID>
+    candidates() {
+        return {
+            PID(Gain(0.5f), Gain(5.0e1f), Gain(3e-4f), Pressure(0.0f)),
+            PID(Gain(0.5f), Gain(5.1e1f), Gain(3e-4f), Pressure(0.0f)),
+        };
+    }
+
+    TEST(Replay, Exact) {
+        std::span<const Record> records = session(5000);
+        ASSERT_EQ(10000u, records.size());
+        EXPECT_TRUE(std::any_of(records.begin(), records.end(), [&](const Record& record) {
+            return record.channel == 0 && record.duration != records[0].duration;
+        }));
+
+        control::Replay<Pressure, PID> replay(candidates(), 0);
+        replay(records);
+
+        EXPECT_EQ(5000u, replay.report(0).samples);
+        EXPECT_EQ(0u, replay.report(0).diverged);
+        EXPECT_FALSE(replay.report(0).first.has_value());
+
+        EXPECT_LT(0u, replay.report(1).diverged);
+        ASSERT_TRUE(replay.report(1).first.has_value());
+        EXPECT_EQ(0u, replay.report(1).first->index);
+        EXPECT_EQ(records[0].timestamp, replay.report(1).first->timestamp);
+    }
+
+    RC_GTEST_PROP(Replay, Chunked, (const std::vector<int>& xs)) {
+        std::size_t chunk = xs.size() + 1;
+        std::span<const Record> records = session(300);
+        control::Replay<Pressure, PID> whole(candidates(), 0, 1e-3f);
+        control::Replay<Pressure, PID> chunked(candidates(), 0, 1e-3f, chunk);
+        whole(records);
+        chunked(records);
+
+        for (std::size_t i = 0; i < whole.size(); i++) {
+            RC_ASSERT(whole.report(i).samples == chunked.report(i).samples);
+            RC_ASSERT(whole.report(i).diverged == chunked.report(i).diverged);
+            RC_ASSERT(whole.report(i).worst == chunked.report(i).worst);
+            RC_ASSERT(whole.report(i).first.has_value() == chunked.report(i).first.has_value());
+        }
+    }
+
+    TEST(Replay, Parallel) {
+        std::span<const Record> records = session(3000);
+        control::Pool pool(2);
+        control::Replay<Pressure, PID> sequential(candidates(), 0, 0.0f, 256);
+        control::Replay<Pressure, PID> parallel(candidates(), 0, 0.0f, 256);
+        sequential(records);
+        parallel(pool, records);
+
+        for (std::size_t i = 0; i < sequential.size(); i++) {
+            EXPECT_EQ(sequential.report(i).diverged, parallel.report(i).diverged);
+            EXPECT_EQ(sequential.report(i).worst, parallel.report(i).worst);
+        }
+    }
+
+    TEST(Replay, Trace) {
+        std::span<const Record> records = session(2000);
+        std::string path = std::string(::testing::TempDir()) + "control-replay.bin";
+        {
+            control::trace::Writer<float> writer(path.c_str());
+            for (const Record& record : records) {
+                writer(record);
+            }
+        }
+
+        control::trace::Reader<float> reader(path.c_str());
+        ASSERT_TRUE(static_cast<bool>(reader));
+        control::Replay<Pressure, PID> replay(candidates(), 0);
+        replay(reader.records());
+        EXPECT_EQ(2000u, replay.report(0).samples);
+        EXPECT_EQ(0u, replay.report(0).diverged);
+        std::remove(path.c_str());
+    }
+} // namespace f32
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+#include <control/control.hpp>
+#include <thread>
+#include <vector>
+
+namespace f32 {
+    using Pressure  = ventilation::Pressure<float>;
+    using Process   = control::Process<Pressure>;
+    using Time      = control::Time<float>;
+    using Value     = control::Value<float>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Ring, Order, (const std::vector<int>& xs)) {
+        control::Ring<Process, 64> ring;
+        std::size_t popped = 0;
+        for (int x : xs) {
+            RC_ASSERT(ring.push(Process{Pressure(static_cast<float>(x)), Time(1ms)}));
+
+            Process process;
+            RC_ASSERT(ring.pop(process));
+            RC_ASSERT(Pressure(static_cast<float>(x)) == process.measurement);
+            popped++;
+        }
+        RC_ASSERT(popped == xs.size());
+        RC_ASSERT(ring.size() == 0u);
+    }
+
+    TEST(Ring, Full) {
+        control::Ring<Value, 4> ring;
+        for (std::size_t i = 0; i < 4; i++) {
+            EXPECT_TRUE(ring.push(Value(Pressure(static_cast<float>(i)))));
+        }
+        EXPECT_FALSE(ring.push(Value(Pressure(4.0f))));
+
+        std::array<Value, 8> values;
+        EXPECT_EQ(4u, ring.pop(values));
+        for (std::size_t i = 0; i < 4; i++) {
+            EXPECT_EQ(Pressure(static_cast<float>(i)), Pressure(values[i]));
+        }
+        EXPECT_EQ(0u, ring.pop(values));
+    }
+
+    TEST(Ring, Batch) {
+        control::Ring<Value, 8> ring;
+        std::array<Value, 6> input;
+        for (std::size_t i = 0; i < input.size(); i++) {
+            input[i] = Value(Pressure(static_cast<float>(i)));
+        }
+
+        EXPECT_EQ(6u, ring.push(input));
+        EXPECT_EQ(2u, ring.push(input));
+        EXPECT_EQ(8u, ring.size());
+
+        std::array<Value, 5> output;
+        EXPECT_EQ(5u, ring.pop(output));
+        EXPECT_EQ(Pressure(4.0f), Pressure(output[4]));
+        EXPECT_EQ(3u, ring.pop(output));
+        EXPECT_EQ(Pressure(1.0f), Pressure(output[2]));
+    }
+
+    TEST(Ring, Threads) {
+        constexpr std::size_t COUNT = 200000;
+        control::Ring<Process, 256> ring;
+
+        std::thread producer([&] {
+            for (std::size_t i = 0; i < COUNT;) {
+                if (ring.push(Process{Pressure(static_cast<float>(i % 1000)), Time(1ms)})) {
+                    i++;
+                }
+            }
+        });
+
+        std::size_t received = 0;
+        bool ordered = true;
+        std::array<Process, 32> batch;
+        while (received < COUNT) {
+            std::size_t count = ring.pop(batch);
+            for (std::size_t i = 0; i < count; i++) {
+                ordered = ordered && (Pressure(static_cast<float>((received + i) % 1000)) == batch[i].measurement);
+            }
+            received += count;
+        }
+        producer.join();
+
+        EXPECT_TRUE(ordered);
+        EXPECT_EQ(COUNT, received);
+    }
+
+    TEST(Latest, Overwrite) {
+        control::Latest<Process> latest;
+        Process process{Pressure(0.0f), Time(1ms)};
+        EXPECT_FALSE(latest.poll(process));
+
+        latest.publish(Process{Pressure(1.0f), Time(1ms)});
+        latest.publish(Process{Pressure(2.0f), Time(1ms)});
+        EXPECT_TRUE(latest.poll(process));
+        EXPECT_EQ(Pressure(2.0f), process.measurement);
+        EXPECT_FALSE(latest.poll(process));
+    }
+
+    TEST(Latest, Threads) {
+        constexpr std::size_t COUNT = 200000;
+        control::Latest<Process> latest;
+
+        std::thread producer([&] {
+            for (std::size_t i = 1; i <= COUNT; i++) {
+                latest.publish(Process{Pressure(static_cast<float>(i)), Time(1ms)});
+            }
+        });
+
+        float last = 0.0f;
+        bool monotonic = true;
+        Process process;
+        while (last < static_cast<float>(COUNT)) {
+            if (latest.poll(process)) {
+                float current = static_cast<float>(process.measurement);
+                monotonic = monotonic && (current > last);
+                last = current;
+            }
+        }
+        producer.join();
+
+        EXPECT_TRUE(monotonic);
+        EXPECT_EQ(static_cast<float>(COUNT), last);
+    }
+} // namespace f32
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,521 @@
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+#include <control/control.hpp>
+#include <cmath>
+#include <vector>
+
+namespace rc {
+    template<typename Precision>
+    struct Arbitrary<ventilation::Flow<Precision>> {
+        static Gen<ventilation::Flow<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Flow<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::Pressure<Precision>> {
+        static Gen<ventilation::Pressure<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Pressure<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::PEEP<Precision>> {
+        static Gen<ventilation::PEEP<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::PEEP<Precision>>(
+                    gen::arbitrary<ventilation::Pressure<Precision>>()
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::Volume<Precision>> {
+        static Gen<ventilation::Volume<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Volume<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+} // namespace rc
+
+namespace f32 {
+    using Flow      = ventilation::Flow<float>;
+    using Pressure  = ventilation::Pressure<float>;
+    using Volume    = ventilation::Volume<float>;
+    using Time      = control::Time<float>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Bounded, Flow, (const Flow& xs)) {
+        control::Saturation<Flow> limits(Flow(-10.0f), Flow(10.0f));
+        float actual = static_cast<float>(limits(xs));
+
+        RC_ASSERT(actual >= -10.0f);
+        RC_ASSERT(actual <= 10.0f);
+        RC_ASSERT((actual == static_cast<float>(xs)) == (std::abs(static_cast<float>(xs)) <= 10.0f));
+    }
+
+    RC_GTEST_PROP(Clamping, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        Flow target = xs * xs + Flow(1.0f);
+        control::Gain<Flow>       gain(5.0e1f);
+        control::Saturation<Flow> limits(Flow(-1.0f), Flow(1.0f));
+        control::Integral<Flow>   integral(gain, target, limits);
+
+        control::Process<Flow> occluded{Flow(0.0f), duration};
+        for (std::size_t i = 0; i < 1000; i++) {
+            float actual = static_cast<float>(Flow(integral(occluded)));
+            RC_ASSERT(actual <= 1.0f);
+        }
+
+        control::Process<Flow> recovered{target + target, duration};
+        RC_ASSERT(static_cast<float>(Flow(integral(recovered))) < 1.0f);
+    }
+
+    RC_GTEST_PROP(BackCalculation, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        Flow target = xs * xs + Flow(1.0f);
+        control::Gain<Flow>       kp(0.5f);
+        control::Gain<Flow>       ki(5.0e1f);
+        control::Gain<Flow>       tracking(1.0e2f);
+        control::Saturation<Flow> limits(Flow(-1.0f), Flow(1.0f));
+        control::PID<Flow>        pid(kp, ki, control::Gain<Flow>(), target, limits, tracking);
+
+        control::Process<Flow> occluded{Flow(0.0f), duration};
+        for (std::size_t i = 0; i < 1000; i++) {
+            float actual = static_cast<float>(Flow(pid(occluded)));
+            RC_ASSERT(actual <= 1.0f);
+            RC_ASSERT(actual >= -1.0f);
+        }
+
+        control::Process<Flow> recovered{target + target, duration};
+        RC_ASSERT(static_cast<float>(Flow(pid(recovered))) < 1.0f);
+    }
+
+    RC_GTEST_PROP(Bounded, Pressure, (const Pressure& xs)) {
+        control::Saturation<Pressure> limits(Pressure(-10.0f), Pressure(10.0f));
+        float actual = static_cast<float>(limits(xs));
+
+        RC_ASSERT(actual >= -10.0f);
+        RC_ASSERT(actual <= 10.0f);
+        RC_ASSERT((actual == static_cast<float>(xs)) == (std::abs(static_cast<float>(xs)) <= 10.0f));
+    }
+
+    RC_GTEST_PROP(Clamping, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        Pressure target = xs * xs + Pressure(1.0f);
+        control::Gain<Pressure>       gain(5.0e1f);
+        control::Saturation<Pressure> limits(Pressure(-1.0f), Pressure(1.0f));
+        control::Integral<Pressure>   integral(gain, target, limits);
+
+        control::Process<Pressure> occluded{Pressure(0.0f), duration};
+        for (std::size_t i = 0; i < 1000; i++) {
+            float actual = static_cast<float>(Pressure(integral(occluded)));
+            RC_ASSERT(actual <= 1.0f);
+        }
+
+        control::Process<Pressure> recovered{target + target, duration};
+        RC_ASSERT(static_cast<float>(Pressure(integral(recovered))) < 1.0f);
+    }
+
+    RC_GTEST_PROP(BackCalculation, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        Pressure target = xs * xs + Pressure(1.0f);
+        control::Gain<Pressure>       kp(0.5f);
+        control::Gain<Pressure>       ki(5.0e1f);
+        control::Gain<Pressure>       tracking(1.0e2f);
+        control::Saturation<Pressure> limits(Pressure(-1.0f), Pressure(1.0f));
+        control::PID<Pressure>        pid(kp, ki, control::Gain<Pressure>(), target, limits, tracking);
+
+        control::Process<Pressure> occluded{Pressure(0.0f), duration};
+        for (std::size_t i = 0; i < 1000; i++) {
+            float actual = static_cast<float>(Pressure(pid(occluded)));
+            RC_ASSERT(actual <= 1.0f);
+            RC_ASSERT(actual >= -1.0f);
+        }
+
+        control::Process<Pressure> recovered{target + target, duration};
+        RC_ASSERT(static_cast<float>(Pressure(pid(recovered))) < 1.0f);
+    }
+
+    RC_GTEST_PROP(Bounded, Volume, (const Volume& xs)) {
+        control::Saturation<Volume> limits(Volume(-10.0f), Volume(10.0f));
+        float actual = static_cast<float>(limits(xs));
+
+        RC_ASSERT(actual >= -10.0f);
+        RC_ASSERT(actual <= 10.0f);
+        RC_ASSERT((actual == static_cast<float>(xs)) == (std::abs(static_cast<float>(xs)) <= 10.0f));
+    }
+
+    RC_GTEST_PROP(Clamping, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        Volume target = xs * xs + Volume(1.0f);
+        control::Gain<Volume>       gain(5.0e1f);
+        control::Saturation<Volume> limits(Volume(-1.0f), Volume(1.0f));
+        control::Integral<Volume>   integral(gain, target, limits);
+
+        control::Process<Volume> occluded{Volume(0.0f), duration};
+        for (std::size_t i = 0; i < 1000; i++) {
+            float actual = static_cast<float>(Volume(integral(occluded)));
+            RC_ASSERT(actual <= 1.0f);
+        }
+
+        control::Process<Volume> recovered{target + target, duration};
+        RC_ASSERT(static_cast<float>(Volume(integral(recovered))) < 1.0f);
+    }
+
+    RC_GTEST_PROP(BackCalculation, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        Volume target = xs * xs + Volume(1.0f);
+        control::Gain<Volume>       kp(0.5f);
+        control::Gain<Volume>       ki(5.0e1f);
+        control::Gain<Volume>       tracking(1.0e2f);
+        control::Saturation<Volume> limits(Volume(-1.0f), Volume(1.0f));
+        control::PID<Volume>        pid(kp, ki, control::Gain<Volume>(), target, limits, tracking);
+
+        control::Process<Volume> occluded{Volume(0.0f), duration};
+        for (std::size_t i = 0; i < 1000; i++) {
+            float actual = static_cast<float>(Volume(pid(occluded)));
+            RC_ASSERT(actual <= 1.0f);
+            RC_ASSERT(actual >= -1.0f);
+        }
+
+        control::Process<Volume> recovered{target + target, duration};
+        RC_ASSERT(static_cast<float>(Volume(pid(recovered))) < 1.0f);
+    }
+} // namespace f32
+namespace f64 {
+    using Flow      = ventilation::Flow<double>;
+    using Pressure  = ventilation::Pressure<double>;
+    using Volume    = ventilation::Volume<double>;
+    using Time      = control::Time<double>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Bounded, Flow, (const Flow& xs)) {
+        control::Saturation<Flow> limits(Flow(-10.0), Flow(10.0));
+        double actual = static_cast<double>(limits(xs));
+
+        RC_ASSERT(actual >= -10.0);
+        RC_ASSERT(actual <= 10.0);
+        RC_ASSERT((actual == static_cast<double>(xs)) == (std::abs(static_cast<double>(xs)) <= 10.0));
+    }
+
+    RC_GTEST_PROP(Clamping, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        Flow target = xs * xs + Flow(1.0);
+        control::Gain<Flow>       gain(5.0e1);
+        control::Saturation<Flow> limits(Flow(-1.0), Flow(1.0));
+        control::Integral<Flow>   integral(gain, target, limits);
+
+        control::Process<Flow> occluded{Flow(0.0), duration};
+        for (std::size_t i = 0; i < 1000; i++) {
+            double actual = static_cast<double>(Flow(integral(occluded)));
+            RC_ASSERT(actual <= 1.0);
+        }
+
+        control::Process<Flow> recovered{target + target, duration};
+        RC_ASSERT(static_cast<double>(Flow(integral(recovered))) < 1.0);
+    }
+
+    RC_GTEST_PROP(BackCalculation, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        Flow target = xs * xs + Flow(1.0);
+        control::Gain<Flow>       kp(0.5);
+        control::Gain<Flow>       ki(5.0e1);
+        control::Gain<Flow>       tracking(1.0e2);
+        control::Saturation<Flow> limits(Flow(-1.0), Flow(1.0));
+        control::PID<Flow>        pid(kp, ki, control::Gain<Flow>(), target, limits, tracking);
+
+        control::Process<Flow> occluded{Flow(0.0), duration};
+        for (std::size_t i = 0; i < 1000; i++) {
+            double actual = static_cast<double>(Flow(pid(occluded)));
+            RC_ASSERT(actual <= 1.0);
+            RC_ASSERT(actual >= -1.0);
+        }
+
+        control::Process<Flow> recovered{target + target, duration};
+        RC_ASSERT(static_cast<double>(Flow(pid(recovered))) < 1.0);
+    }
+
+    RC_GTEST_PROP(Bounded, Pressure, (const Pressure& xs)) {
+        control::Saturation<Pressure> limits(Pressure(-10.0), Pressure(10.0));
+        double actual = static_cast<double>(limits(xs));
+
+        RC_ASSERT(actual >= -10.0);
+        RC_ASSERT(actual <= 10.0);
+        RC_ASSERT((actual == static_cast<double>(xs)) == (std::abs(static_cast<double>(xs)) <= 10.0));
+    }
+
+    RC_GTEST_PROP(Clamping, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        Pressure target = xs * xs + Pressure(1.0);
+        control::Gain<Pressure>       gain(5.0e1);
+        control::Saturation<Pressure> limits(Pressure(-1.0), Pressure(1.0));
+        control::Integral<Pressure>   integral(gain, target, limits);
+
+        control::Process<Pressure> occluded{Pressure(0.0), duration};
+        for (std::size_t i = 0; i < 1000; i++) {
+            double actual = static_cast<double>(Pressure(integral(occluded)));
+            RC_ASSERT(actual <= 1.0);
+        }
+
+        control::Process<Pressure> recovered{target + target, duration};
+        RC_ASSERT(static_cast<double>(Pressure(integral(recovered))) < 1.0);
+    }
+
+    RC_GTEST_PROP(BackCalculation, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        Pressure target = xs * xs + Pressure(1.0);
+        control::Gain<Pressure>       kp(0.5);
+        control::Gain<Pressure>       ki(5.0e1);
+        control::Gain<Pressure>       tracking(1.0e2);
+        control::Saturation<Pressure> limits(Pressure(-1.0), Pressure(1.0));
+        control::PID<Pressure>        pid(kp, ki, control::Gain<Pressure>(), target, limits, tracking);
+
+        control::Process<Pressure> occluded{Pressure(0.0), duration};
+        for (std::size_t i = 0; i < 1000; i++) {
+            double actual = static_cast<double>(Pressure(pid(occluded)));
+            RC_ASSERT(actual <= 1.0);
+            RC_ASSERT(actual >= -1.0);
+        }
+
+        control::Process<Pressure> recovered{target + target, duration};
+        RC_ASSERT(static_cast<double>(Pressure(pid(recovered))) < 1.0);
+    }
+
+    RC_GTEST_PROP(Bounded, Volume, (const Volume& xs)) {
+        control::Saturation<Volume> limits(Volume(-10.0), Volume(10.0));
+        double actual = static_cast<double>(limits(xs));
+
+        RC_ASSERT(actual >= -10.0);
+        RC_ASSERT(actual <= 10.0);
+        RC_ASSERT((actual == static_cast<double>(xs)) == (std::abs(static_cast<double>(xs)) <= 10.0));
+    }
+
+    RC_GTEST_PROP(Clamping, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        Volume target = xs * xs + Volume(1.0);
+        control::Gain<Volume>       gain(5.0e1);
+        control::Saturation<Volume> limits(Volume(-1.0), Volume(1.0));
+        control::Integral<Volume>   integral(gain, target, limits);
+
+        control::Process<Volume> occluded{Volume(0.0), duration};
+        for (std::size_t i = 0; i < 1000; i++) {
+            double actual = static_cast<double>(Volume(integral(occluded)));
+            RC_ASSERT(actual <= 1.0);
+        }
+
+        control::Process<Volume> recovered{target + target, duration};
+        RC_ASSERT(static_cast<double>(Volume(integral(recovered))) < 1.0);
+    }
+
+    RC_GTEST_PROP(BackCalculation, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        Volume target = xs * xs + Volume(1.0);
+        control::Gain<Volume>       kp(0.5);
+        control::Gain<Volume>       ki(5.0e1);
+        control::Gain<Volume>       tracking(1.0e2);
+        control::Saturation<Volume> limits(Volume(-1.0), Volume(1.0));
+        control::PID<Volume>        pid(kp, ki, control::Gain<Volume>(), target, limits, tracking);
+
+        control::Process<Volume> occluded{Volume(0.0), duration};
+        for (std::size_t i = 0; i < 1000; i++) {
+            double actual = static_cast<double>(Volume(pid(occluded)));
+            RC_ASSERT(actual <= 1.0);
+            RC_ASSERT(actual >= -1.0);
+        }
+
+        control::Process<Volume> recovered{target + target, duration};
+        RC_ASSERT(static_cast<double>(Volume(pid(recovered))) < 1.0);
+    }
+    TEST(BackCalculation, Independent) {
+        Time duration = 1ms;
+        Pressure target(1.0);
+        control::Gain<Pressure>       tracking(1.0e2);
+        control::Saturation<Pressure> limits(Pressure(-1.0), Pressure(1.0));
+
+        std::vector<std::size_t> recovery;
+        for (double gain : {5.0e1, 5.0e3, 5.0e5}) {
+            control::PID<Pressure> pid(control::Gain<Pressure>()
+                , control::Gain<Pressure>(gain)
+                , control::Gain<Pressure>()
+                , target
+                , limits
+                , tracking);
+
+            control::Process<Pressure> occluded{Pressure(0.0), duration};
+            for (std::size_t i = 0; i < 1000; i++) {
+                EXPECT_LE(static_cast<double>(Pressure(pid(occluded))), 1.0);
+            }
+
+            control::Process<Pressure> recovered{target + target, duration};
+            std::size_t ticks = 0;
+            while (static_cast<double>(Pressure(pid(recovered))) >= 1.0 && ticks < 1000) {
+                ticks++;
+            }
+            recovery.push_back(ticks);
+        }
+
+        EXPECT_LT(recovery.front(), 20u);
+        EXPECT_EQ(recovery.front(), recovery[1]);
+        EXPECT_EQ(recovery.front(), recovery.back());
+    }
+} // namespace f64
+namespace f128 {
+    using Flow      = ventilation::Flow<long double>;
+    using Pressure  = ventilation::Pressure<long double>;
+    using Volume    = ventilation::Volume<long double>;
+    using Time      = control::Time<long double>;
+    using namespace std::chrono_literals;
+
+    RC_GTEST_PROP(Bounded, Flow, (const Flow& xs)) {
+        control::Saturation<Flow> limits(Flow(-10.0L), Flow(10.0L));
+        long double actual = static_cast<long double>(limits(xs));
+
+        RC_ASSERT(actual >= -10.0L);
+        RC_ASSERT(actual <= 10.0L);
+        RC_ASSERT((actual == static_cast<long double>(xs)) == (std::abs(static_cast<long double>(xs)) <= 10.0L));
+    }
+
+    RC_GTEST_PROP(Clamping, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        Flow target = xs * xs + Flow(1.0L);
+        control::Gain<Flow>       gain(5.0e1L);
+        control::Saturation<Flow> limits(Flow(-1.0L), Flow(1.0L));
+        control::Integral<Flow>   integral(gain, target, limits);
+
+        control::Process<Flow> occluded{Flow(0.0L), duration};
+        for (std::size_t i = 0; i < 1000; i++) {
+            long double actual = static_cast<long double>(Flow(integral(occluded)));
+            RC_ASSERT(actual <= 1.0L);
+        }
+
+        control::Process<Flow> recovered{target + target, duration};
+        RC_ASSERT(static_cast<long double>(Flow(integral(recovered))) < 1.0L);
+    }
+
+    RC_GTEST_PROP(BackCalculation, Flow, (const Flow& xs)) {
+        Time duration = 1ms;
+        Flow target = xs * xs + Flow(1.0L);
+        control::Gain<Flow>       kp(0.5L);
+        control::Gain<Flow>       ki(5.0e1L);
+        control::Gain<Flow>       tracking(1.0e2L);
+        control::Saturation<Flow> limits(Flow(-1.0L), Flow(1.0L));
+        control::PID<Flow>        pid(kp, ki, control::Gain<Flow>(), target, limits, tracking);
+
+        control::Process<Flow> occluded{Flow(0.0L), duration};
+        for (std::size_t i = 0; i < 1000; i++) {
+            long double actual = static_cast<long double>(Flow(pid(occluded)));
+            RC_ASSERT(actual <= 1.0L);
+            RC_ASSERT(actual >= -1.0L);
+        }
+
+        control::Process<Flow> recovered{target + target, duration};
+        RC_ASSERT(static_cast<long double>(Flow(pid(recovered))) < 1.0L);
+    }
+
+    RC_GTEST_PROP(Bounded, Pressure, (const Pressure& xs)) {
+        control::Saturation<Pressure> limits(Pressure(-10.0L), Pressure(10.0L));
+        long double actual = static_cast<long double>(limits(xs));
+
+        RC_ASSERT(actual >= -10.0L);
+        RC_ASSERT(actual <= 10.0L);
+        RC_ASSERT((actual == static_cast<long double>(xs)) == (std::abs(static_cast<long double>(xs)) <= 10.0L));
+    }
+
+    RC_GTEST_PROP(Clamping, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        Pressure target = xs * xs + Pressure(1.0L);
+        control::Gain<Pressure>       gain(5.0e1L);
+        control::Saturation<Pressure> limits(Pressure(-1.0L), Pressure(1.0L));
+        control::Integral<Pressure>   integral(gain, target, limits);
+
+        control::Process<Pressure> occluded{Pressure(0.0L), duration};
+        for (std::size_t i = 0; i < 1000; i++) {
+            long double actual = static_cast<long double>(Pressure(integral(occluded)));
+            RC_ASSERT(actual <= 1.0L);
+        }
+
+        control::Process<Pressure> recovered{target + target, duration};
+        RC_ASSERT(static_cast<long double>(Pressure(integral(recovered))) < 1.0L);
+    }
+
+    RC_GTEST_PROP(BackCalculation, Pressure, (const Pressure& xs)) {
+        Time duration = 1ms;
+        Pressure target = xs * xs + Pressure(1.0L);
+        control::Gain<Pressure>       kp(0.5L);
+        control::Gain<Pressure>       ki(5.0e1L);
+        control::Gain<Pressure>       tracking(1.0e2L);
+        control::Saturation<Pressure> limits(Pressure(-1.0L), Pressure(1.0L));
+        control::PID<Pressure>        pid(kp, ki, control::Gain<Pressure>(), target, limits, tracking);
+
+        control::Process<Pressure> occluded{Pressure(0.0L), duration};
+        for (std::size_t i = 0; i < 1000; i++) {
+            long double actual = static_cast<long double>(Pressure(pid(occluded)));
+            RC_ASSERT(actual <= 1.0L);
+            RC_ASSERT(actual >= -1.0L);
+        }
+
+        control::Process<Pressure> recovered{target + target, duration};
+        RC_ASSERT(static_cast<long double>(Pressure(pid(recovered))) < 1.0L);
+    }
+
+    RC_GTEST_PROP(Bounded, Volume, (const Volume& xs)) {
+        control::Saturation<Volume> limits(Volume(-10.0L), Volume(10.0L));
+        long double actual = static_cast<long double>(limits(xs));
+
+        RC_ASSERT(actual >= -10.0L);
+        RC_ASSERT(actual <= 10.0L);
+        RC_ASSERT((actual == static_cast<long double>(xs)) == (std::abs(static_cast<long double>(xs)) <= 10.0L));
+    }
+
+    RC_GTEST_PROP(Clamping, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        Volume target = xs * xs + Volume(1.0L);
+        control::Gain<Volume>       gain(5.0e1L);
+        control::Saturation<Volume> limits(Volume(-1.0L), Volume(1.0L));
+        control::Integral<Volume>   integral(gain, target, limits);
+
+        control::Process<Volume> occluded{Volume(0.0L), duration};
+        for (std::size_t i = 0; i < 1000; i++) {
+            long double actual = static_cast<long double>(Volume(integral(occluded)));
+            RC_ASSERT(actual <= 1.0L);
+        }
+
+        control::Process<Volume> recovered{target + target, duration};
+        RC_ASSERT(static_cast<long double>(Volume(integral(recovered))) < 1.0L);
+    }
+
+    RC_GTEST_PROP(BackCalculation, Volume, (const Volume& xs)) {
+        Time duration = 1ms;
+        Volume target = xs * xs + Volume(1.0L);
+        control::Gain<Volume>       kp(0.5L);
+        control::Gain<Volume>       ki(5.0e1L);
+        control::Gain<Volume>       tracking(1.0e2L);
+        control::Saturation<Volume> limits(Volume(-1.0L), Volume(1.0L));
+        control::PID<Volume>        pid(kp, ki, control::Gain<Volume>(), target, limits, tracking);
+
+        control::Process<Volume> occluded{Volume(0.0L), duration};
+        for (std::size_t i = 0; i < 1000; i++) {
+            long double actual = static_cast<long double>(Volume(pid(occluded)));
+            RC_ASSERT(actual <= 1.0L);
+            RC_ASSERT(actual >= -1.0L);
+        }
+
+        control::Process<Volume> recovered{target + target, duration};
+        RC_ASSERT(static_cast<long double>(Volume(pid(recovered))) < 1.0L);
+    }
+} // namespace f128
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+#include <control/control.hpp>
+#include <cmath>
+
+namespace rc {
+    template<typename Precision>
+    struct Arbitrary<ventilation::Pressure<Precision>> {
+        static Gen<ventilation::Pressure<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Pressure<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+
+    template<typename Precision>
+    struct Arbitrary<ventilation::Volume<Precision>> {
+        static Gen<ventilation::Volume<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Volume<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+} // namespace rc
+
+namespace f32 {
+    using Pressure      = ventilation::Pressure<float>;
+    using Volume        = ventilation::Volume<float>;
+    using Process       = control::Process<Pressure>;
+    using Gain          = control::Gain<Pressure>;
+    using Breakpoint    = control::Breakpoint<Pressure>;
+    using Time          = control::Time<float>;
+    using namespace std::chrono_literals;
+
+    std::array<Breakpoint, 5>
+    table() {
+        std::array<Breakpoint, 5> result;
+        for (std::size_t i = 0; i < result.size(); i++) {
+            float x     = static_cast<float>(i);
+            result[i]   = Breakpoint{Gain(x), Gain(2.0f * x), Gain(x * x)};
+        }
+        return result;
+    }
+
+    TEST(Schedule, Breakpoints) {
+        control::Schedule<Pressure, Volume, 5> schedule(Volume(0.0f), Volume(400.0f), table());
+        for (std::size_t i = 0; i < 5; i++) {
+            float x = static_cast<float>(i);
+            Breakpoint gains = schedule(Volume(100.0f * x));
+            EXPECT_FLOAT_EQ(x, static_cast<float>(gains.proportional));
+            EXPECT_FLOAT_EQ(2.0f * x, static_cast<float>(gains.integral));
+            EXPECT_FLOAT_EQ(x * x, static_cast<float>(gains.differential));
+        }
+    }
+
+    TEST(Schedule, Clamp) {
+        control::Schedule<Pressure, Volume, 5> schedule(Volume(0.0f), Volume(400.0f), table());
+        EXPECT_FLOAT_EQ(0.0f, static_cast<float>(schedule(Volume(-50.0f)).proportional));
+        EXPECT_FLOAT_EQ(4.0f, static_cast<float>(schedule(Volume(1000.0f)).proportional));
+        EXPECT_FLOAT_EQ(16.0f, static_cast<float>(schedule(Volume(1000.0f)).differential));
+    }
+
+    RC_GTEST_PROP(Schedule, Interpolation, (const Volume& xs)) {
+        float x = 2.0f * (static_cast<float>(xs) + 100.0f);
+        control::Schedule<Pressure, Volume, 5> schedule(Volume(0.0f), Volume(400.0f), table());
+        Breakpoint gains = schedule(Volume(x));
+
+        float position = x / 100.0f;
+        RC_ASSERT(std::abs(position - static_cast<float>(gains.proportional)) < 1e-4f);
+        RC_ASSERT(std::abs(2.0f * position - static_cast<float>(gains.integral)) < 1e-4f);
+    }
+
+    RC_GTEST_PROP(Schedule, Uniform, (const Volume& xs)) {
+        float x = 3.0f * static_cast<float>(xs) + 200.0f;
+        std::array<Volume, 5> positions{Volume(0.0f), Volume(100.0f), Volume(200.0f), Volume(300.0f), Volume(400.0f)};
+        control::Schedule<Pressure, Volume, 5> uniform(Volume(0.0f), Volume(400.0f), table());
+        control::Schedule<Pressure, Volume, 5> searched(positions, table());
+
+        RC_ASSERT(std::abs(static_cast<float>(uniform(Volume(x)).proportional)
+                    - static_cast<float>(searched(Volume(x)).proportional)) < 1e-4f);
+        RC_ASSERT(std::abs(static_cast<float>(uniform(Volume(x)).differential)
+                    - static_cast<float>(searched(Volume(x)).differential)) < 1e-3f);
+    }
+
+    TEST(Schedule, NonUniform) {
+        std::array<Volume, 3> positions{Volume(0.0f), Volume(10.0f), Volume(110.0f)};
+        std::array<Breakpoint, 3> gains{
+            Breakpoint{Gain(0.0f), Gain(0.0f), Gain(0.0f)},
+            Breakpoint{Gain(1.0f), Gain(0.0f), Gain(0.0f)},
+            Breakpoint{Gain(2.0f), Gain(0.0f), Gain(0.0f)},
+        };
+        control::Schedule<Pressure, Volume, 3> schedule(positions, gains);
+        EXPECT_FLOAT_EQ(0.5f, static_cast<float>(schedule(Volume(5.0f)).proportional));
+        EXPECT_FLOAT_EQ(1.5f, static_cast<float>(schedule(Volume(60.0f)).proportional));
+    }
+
+    RC_GTEST_PROP(Scheduled, Constant, (const Pressure& xs)) {
+        Time duration = 1ms;
+        Breakpoint gains{Gain(0.5f), Gain(5.0e1f), Gain(3e-4f)};
+        control::Schedule<Pressure, Volume, 2> schedule(Volume(0.0f), Volume(1.0f), {gains, gains});
+        control::Scheduled<Pressure, Volume, 2> scheduled(schedule, xs);
+        control::PID<Pressure> pid(gains.proportional, gains.integral, gains.differential, xs);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            Process process{scale * xs, duration};
+            RC_ASSERT(static_cast<Pressure>(pid(process))
+                    == static_cast<Pressure>(scheduled(process, Volume(scale))));
+        }
+    }
+
+    RC_GTEST_PROP(Scheduled, Path, (const Pressure& xs)) {
+        Time duration = 1ms;
+        Breakpoint low{Gain(0.5f), Gain(5.0e1f), Gain(3e-4f)};
+        Breakpoint high{Gain(1.0f), Gain(2.0e2f), Gain(6e-4f)};
+        control::Schedule<Pressure, Volume, 2> schedule(Volume(0.0f), Volume(1.0f), {low, high});
+        control::Scheduled<Pressure, Volume, 2> wandering(schedule, xs);
+        control::Scheduled<Pressure, Volume, 2> fixed(schedule, xs);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            float scale = static_cast<float>(i) / 100.0f;
+            Process process{scale * xs, duration};
+            wandering(process, Volume(static_cast<float>(i % 3) / 2.0f));
+            fixed(process, Volume(0.5f));
+        }
+
+        Process process{xs, duration};
+        RC_ASSERT(static_cast<Pressure>(fixed(process, Volume(0.5f)))
+                == static_cast<Pressure>(wandering(process, Volume(0.5f))));
+    }
+} // namespace f32
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
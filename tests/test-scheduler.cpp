@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include <control/control.hpp>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace f32 {
+    using Flow      = ventilation::Flow<float>;
+    using Pressure  = ventilation::Pressure<float>;
+    using Volume    = ventilation::Volume<float>;
+    using Time      = control::Time<float>;
+    using namespace std::chrono_literals;
+
+    template <typename Target>
+    class Recording {
+        public:
+            control::Value<float>
+            operator()(const control::Process<Target>& current) {
+                durations.push_back(current.duration.count());
+                return control::Value<float>(current.measurement);
+            }
+
+            std::vector<float> durations;
+    };
+
+    TEST(Scheduler, Rates) {
+        std::vector<std::size_t> ticks;
+        std::size_t tick = 0;
+        auto sense      = [] { return Pressure(1.0f); };
+        auto actuate    = [](const control::Value<float>&) {};
+        auto record     = [&ticks, &tick](const control::Value<float>&) { ticks.push_back(tick); };
+
+        control::Scheduler scheduler(
+            control::Group(Recording<Pressure>(), 1, sense, actuate)
+            , control::Group(Recording<Flow>(), 2, [] { return Flow(2.0f); }, actuate)
+            , control::Group(Recording<Volume>(), 20, [] { return Volume(3.0f); }, record)
+            );
+        EXPECT_EQ(20u, scheduler.hyperperiod());
+
+        for (tick = 0; tick < 200; tick++) {
+            scheduler(Time(500us));
+        }
+
+        EXPECT_EQ(200u, scheduler.get<0>().durations.size());
+        EXPECT_EQ(100u, scheduler.get<1>().durations.size());
+        EXPECT_EQ(10u, scheduler.get<2>().durations.size());
+        EXPECT_FLOAT_EQ(5e-4f * static_cast<float>(scheduler.phase(1) + 1), scheduler.get<1>().durations.front());
+        EXPECT_FLOAT_EQ(5e-4f * static_cast<float>(scheduler.phase(2) + 1), scheduler.get<2>().durations.front());
+        for (std::size_t i = 1; i < scheduler.get<1>().durations.size(); i++) {
+            EXPECT_FLOAT_EQ(1e-3f, scheduler.get<1>().durations[i]);
+        }
+        for (std::size_t i = 1; i < scheduler.get<2>().durations.size(); i++) {
+            EXPECT_FLOAT_EQ(1e-2f, scheduler.get<2>().durations[i]);
+        }
+        for (std::size_t i = 0; i < ticks.size(); i++) {
+            EXPECT_EQ(scheduler.phase(2) + 20 * i, ticks[i]);
+        }
+    }
+
+    TEST(Scheduler, Stagger) {
+        auto actuate = [](const control::Value<float>&) {};
+        auto sense   = [] { return Pressure(0.0f); };
+        control::Scheduler scheduler(
+            control::Group(Recording<Pressure>(), 2, sense, actuate)
+            , control::Group(Recording<Pressure>(), 2, sense, actuate)
+            , control::Group(Recording<Pressure>(), 4, sense, actuate)
+            , control::Group(Recording<Pressure>(), 4, sense, actuate)
+            );
+
+        EXPECT_EQ(4u, scheduler.hyperperiod());
+        EXPECT_NE(scheduler.phase(0), scheduler.phase(1));
+
+        std::array<std::size_t, 4> load{};
+        for (std::size_t group = 0; group < 4; group++) {
+            std::size_t divisor = group < 2 ? 2 : 4;
+            for (std::size_t tick = scheduler.phase(group); tick < 4; tick += divisor) {
+                load[tick]++;
+            }
+        }
+        EXPECT_EQ(2u, *std::max_element(load.begin(), load.end()));
+    }
+
+    TEST(Scheduler, Jitter) {
+        auto actuate = [](const control::Value<float>&) {};
+        control::Scheduler scheduler(
+            control::Group(Recording<Pressure>(), 3, [] { return Pressure(0.0f); }, actuate)
+            );
+
+        std::array<Time, 7> durations{Time(1ms), Time(1ms), Time(1ms), Time(2ms), Time(1ms), Time(3ms), Time(1ms)};
+        for (const Time& duration : durations) {
+            scheduler(duration);
+        }
+
+        const std::vector<float>& recorded = scheduler.get<0>().durations;
+        ASSERT_EQ(3u, recorded.size());
+        EXPECT_FLOAT_EQ(1e-3f, recorded[0]);
+        EXPECT_FLOAT_EQ(4e-3f, recorded[1]);
+        EXPECT_FLOAT_EQ(5e-3f, recorded[2]);
+    }
+
+    TEST(Scheduler, Worst) {
+        auto actuate    = [](const control::Value<float>&) {};
+        auto slow       = [](const control::Value<float>&) { std::this_thread::sleep_for(1ms); };
+        control::Scheduler scheduler(
+            control::Group(control::PID<Pressure>(control::Gain<Pressure>(0.5f), control::Gain<Pressure>(5.0e1f), control::Gain<Pressure>(3e-4f), Pressure(1.0f))
+                , 1, [] { return Pressure(0.0f); }, actuate)
+            , control::Group(control::PID<Flow>(control::Gain<Flow>(0.5f), control::Gain<Flow>(5.0e1f), control::Gain<Flow>(3e-4f), Flow(1.0f))
+                , 5, [] { return Flow(0.0f); }, slow)
+            );
+
+        for (std::size_t i = 0; i < 100; i++) {
+            scheduler(Time(1ms));
+        }
+        ASSERT_EQ(5u, scheduler.worst().size());
+
+        std::uint64_t fired = scheduler.worst()[scheduler.phase(1)];
+        for (std::size_t phase = 0; phase < scheduler.hyperperiod(); phase++) {
+            if (phase != scheduler.phase(1)) {
+                EXPECT_GT(fired, scheduler.worst()[phase]);
+            }
+        }
+
+        scheduler.reset();
+        for (std::uint64_t worst : scheduler.worst()) {
+            EXPECT_EQ(0u, worst);
+        }
+    }
+} // namespace f32
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
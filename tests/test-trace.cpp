@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+#include <control/control.hpp>
+#include <control/control-trace.hpp>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace f32 {
+    using Record = control::trace::Record<float>;
+
+    std::string
+    temporary(const char* name) {
+        return std::string(::testing::TempDir()) + name;
+    }
+
+    RC_GTEST_PROP(Trace, RoundTrip, (const std::vector<float>& xs)) {
+        std::string path = temporary("control-trace-f32.bin");
+        {
+            control::trace::Writer<float> writer(path.c_str(), 16);
+            RC_ASSERT(static_cast<bool>(writer));
+            for (std::size_t i = 0; i < xs.size(); i++) {
+                writer(Record{i * 1000000u, static_cast<std::uint32_t>(i % 4), 0, 1e-3f * static_cast<float>(i), xs[i], 1.0f, 0.5f * xs[i], 0.0f, 0.0f, xs[i], 0.0f});
+            }
+        }
+
+        control::trace::Reader<float> reader(path.c_str());
+        RC_ASSERT(static_cast<bool>(reader));
+        RC_ASSERT(xs.size() == reader.records().size());
+        for (std::size_t i = 0; i < xs.size(); i++) {
+            const Record& record = reader.records()[i];
+            RC_ASSERT(i * 1000000u == record.timestamp);
+            RC_ASSERT(i % 4 == record.channel);
+            RC_ASSERT(1e-3f * static_cast<float>(i) == record.duration);
+            RC_ASSERT(xs[i] == record.measurement);
+            RC_ASSERT(0.5f * xs[i] == record.proportional);
+        }
+        std::remove(path.c_str());
+    }
+
+    TEST(Trace, Flush) {
+        std::string path = temporary("control-trace-flush.bin");
+        control::trace::Writer<float> writer(path.c_str(), 1024);
+        writer(Record{1, 0, 0, 1e-3f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f});
+        {
+            control::trace::Reader<float> reader(path.c_str());
+            ASSERT_TRUE(static_cast<bool>(reader));
+            EXPECT_EQ(0u, reader.records().size());
+        }
+
+        EXPECT_TRUE(writer.flush());
+        control::trace::Reader<float> reader(path.c_str());
+        ASSERT_EQ(1u, reader.records().size());
+        EXPECT_EQ(6.0f, reader.records()[0].output);
+        EXPECT_EQ(0.0f, reader.records()[0].reserved);
+        std::remove(path.c_str());
+    }
+
+    TEST(Trace, Precision) {
+        std::string path = temporary("control-trace-f64.bin");
+        {
+            control::trace::Writer<double> writer(path.c_str());
+            writer(control::trace::Record<double>{1, 0, 0, 1e-3, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 0.0});
+        }
+
+        EXPECT_FALSE(static_cast<bool>(control::trace::Reader<float>(path.c_str())));
+        control::trace::Reader<double> reader(path.c_str());
+        ASSERT_TRUE(static_cast<bool>(reader));
+        EXPECT_EQ(2.0, reader.records()[0].target);
+        std::remove(path.c_str());
+    }
+
+    TEST(Trace, Version) {
+        std::string path = temporary("control-trace-v1.bin");
+        {
+            control::trace::Header h = control::trace::header<float>();
+            h.version = 1;
+            std::FILE* file = std::fopen(path.c_str(), "wb");
+            ASSERT_NE(nullptr, file);
+            std::fwrite(&h, sizeof(h), 1, file);
+            std::fclose(file);
+        }
+
+        EXPECT_FALSE(static_cast<bool>(control::trace::Reader<float>(path.c_str())));
+        std::remove(path.c_str());
+    }
+
+    TEST(Trace, Blocks) {
+        std::string path = temporary("control-trace-blocks.bin");
+        std::uint64_t dropped = 0;
+        {
+            control::trace::Writer<float> writer(path.c_str(), 4);
+            for (std::uint64_t i = 0; i < 100000; i++) {
+                writer(Record{i, 0, 0, 1e-3f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
+            }
+            EXPECT_TRUE(writer.flush());
+            dropped = writer.dropped();
+        }
+
+        control::trace::Reader<float> reader(path.c_str());
+        ASSERT_TRUE(static_cast<bool>(reader));
+        EXPECT_EQ(100000u, reader.records().size() + dropped);
+        for (std::size_t i = 1; i < reader.records().size(); i++) {
+            EXPECT_LT(reader.records()[i - 1].timestamp, reader.records()[i].timestamp);
+        }
+        std::remove(path.c_str());
+    }
+
+    TEST(Trace, Missing) {
+        EXPECT_FALSE(static_cast<bool>(control::trace::Reader<float>("/nonexistent/control-trace.bin")));
+        EXPECT_FALSE(static_cast<bool>(control::trace::Writer<float>("/nonexistent/control-trace.bin")));
+    }
+} // namespace f32
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
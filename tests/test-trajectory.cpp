@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+#include <control/control.hpp>
+
+namespace rc {
+    template<typename Precision>
+    struct Arbitrary<ventilation::Pressure<Precision>> {
+        static Gen<ventilation::Pressure<Precision>>
+        arbitrary() {
+            return gen::construct<ventilation::Pressure<Precision>>(
+                    gen::cast<Precision>(gen::inRange(-100, 100))
+                    );
+        }
+    };
+} // namespace rc
+
+namespace f32 {
+    using Pressure      = ventilation::Pressure<float>;
+    using Process       = control::Process<Pressure>;
+    using Trajectory    = control::Trajectory<Pressure>;
+    using Time          = control::Time<float>;
+    using namespace std::chrono_literals;
+
+    TEST(Trajectory, Square) {
+        Trajectory trajectory = Trajectory::square(Pressure(5.0f), Pressure(20.0f), Time(3s), Time(1ms), 1.0f / 3.0f);
+        EXPECT_EQ(3000u, trajectory.size());
+        for (std::size_t i = 0; i < 3000; i++) {
+            EXPECT_EQ(i < 1000 ? Pressure(20.0f) : Pressure(5.0f), trajectory());
+        }
+        EXPECT_EQ(Pressure(20.0f), trajectory());
+    }
+
+    TEST(Trajectory, Ramp) {
+        Trajectory trajectory = Trajectory::ramp(Pressure(0.0f), Pressure(60.0f), Time(4s), Time(10ms), 0.25f);
+        std::span<const Pressure> table = trajectory.table();
+        EXPECT_EQ(Pressure(60.0f), table[0]);
+        EXPECT_EQ(Pressure(30.0f), table[50]);
+        EXPECT_EQ(Pressure(0.0f), table[100]);
+        for (std::size_t i = 1; i < 100; i++) {
+            EXPECT_LT(static_cast<float>(table[i]), static_cast<float>(table[i - 1]));
+        }
+    }
+
+    TEST(Trajectory, Sine) {
+        Trajectory trajectory = Trajectory::sine(Pressure(10.0f), Pressure(30.0f), Time(2s), Time(1ms));
+        std::span<const Pressure> table = trajectory.table();
+        EXPECT_EQ(Pressure(20.0f), table[0]);
+        EXPECT_EQ(Pressure(30.0f), table[500]);
+        EXPECT_EQ(Pressure(20.0f), table[1000]);
+        EXPECT_EQ(Pressure(10.0f), table[1500]);
+    }
+
+    TEST(Trajectory, Piecewise) {
+        std::array<std::pair<Time, Pressure>, 3> points{
+            std::pair{Time(0s), Pressure(0.0f)},
+            std::pair{Time(1s), Pressure(10.0f)},
+            std::pair{Time(2s), Pressure(4.0f)},
+        };
+        Trajectory trajectory = Trajectory::piecewise(points, Time(3s), Time(100ms));
+        std::span<const Pressure> table = trajectory.table();
+        EXPECT_EQ(30u, table.size());
+        EXPECT_EQ(Pressure(5.0f), table[5]);
+        EXPECT_EQ(Pressure(10.0f), table[10]);
+        EXPECT_EQ(Pressure(7.0f), table[15]);
+        EXPECT_EQ(Pressure(4.0f), table[25]);
+    }
+
+    RC_GTEST_PROP(Trajectory, Tracking, (const Pressure& xs)) {
+        Time duration = 1ms;
+        control::Gain<Pressure>         kp(0.5f);
+        control::Gain<Pressure>         ki(5.0e1f);
+        control::Gain<Pressure>         kd(3e-4f);
+        control::PID<Pressure>          pid(kp, ki, kd, Pressure(0.0f));
+        control::Proportional<Pressure> proportional(kp, Pressure(0.0f));
+        control::Integral<Pressure>     integral(ki, Pressure(0.0f));
+        control::Differential<Pressure> differential(kd, Pressure(0.0f));
+        Trajectory trajectory = Trajectory::square(Pressure(0.0f), xs, Time(20ms), duration, 0.5f);
+
+        for (std::size_t i = 0; i < 100; i++) {
+            const Pressure& target = trajectory();
+            Process process{Pressure(0.0f), duration};
+
+            Pressure expected   = static_cast<Pressure>(proportional(process, target))
+                                + static_cast<Pressure>(integral(process, target))
+                                + static_cast<Pressure>(differential(process, target));
+            Pressure actual     = static_cast<Pressure>(pid(process, target));
+
+            RC_ASSERT(expected == actual);
+        }
+    }
+} // namespace f32
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <control/control.hpp>
+#include <atomic>
+
+namespace f32 {
+    using Pressure      = ventilation::Pressure<float>;
+    using Parameters    = control::Parameters<Pressure>;
+    using Time          = control::Time<float>;
+    using namespace std::chrono_literals;
+
+    class Lags {
+        public:
+            Pressure
+            operator()(const Pressure& command, const Time& duration) {
+                float alpha = duration.count() / (1.0f + duration.count());
+                float input = static_cast<float>(command);
+                for (float& state : states_) {
+                    state  += (input - state) * alpha;
+                    input   = state;
+                }
+                return Pressure(input);
+            }
+        private:
+            std::array<float, 3> states_{};
+    };
+
+    TEST(Relay, Lags) {
+        auto ultimate = control::relay(Lags(), Pressure(0.0f), Pressure(0.0f), Pressure(1.0f), Pressure(0.0f), Time(1ms), 100000);
+        ASSERT_TRUE(ultimate.has_value());
+        EXPECT_NEAR(8.0f, ultimate->gain, 1.0f);
+        EXPECT_NEAR(3.628f, ultimate->period.count(), 0.2f);
+    }
+
+    TEST(Relay, Stalled) {
+        auto plant = [](const Pressure&, const Time&) { return Pressure(0.0f); };
+        auto ultimate = control::relay(plant, Pressure(0.0f), Pressure(1.0f), Pressure(1.0f), Pressure(0.1f), Time(1ms), 1000);
+        EXPECT_FALSE(ultimate.has_value());
+    }
+
+    TEST(ZieglerNichols, Classic) {
+        Parameters parameters = control::ziegler_nichols(control::Ultimate<float>{10.0f, Time(2s)}, Pressure(20.0f));
+        EXPECT_FLOAT_EQ(6.0f, static_cast<float>(parameters.proportional));
+        EXPECT_FLOAT_EQ(6.0f, static_cast<float>(parameters.integral));
+        EXPECT_FLOAT_EQ(1.5f, static_cast<float>(parameters.differential));
+        EXPECT_EQ(Pressure(20.0f), parameters.target);
+    }
+
+    TEST(Refine, Quadratic) {
+        control::Pool pool(2);
+        Parameters initial{control::Gain<Pressure>(1.0f), control::Gain<Pressure>(1.0f), control::Gain<Pressure>(1.0f), Pressure(0.0f)};
+        auto cost = [](const Parameters& p) {
+            float kp = static_cast<float>(p.proportional) - 2.0f;
+            float ki = static_cast<float>(p.integral) - 3.0f;
+            float kd = static_cast<float>(p.differential) - 0.5f;
+            return kp * kp + ki * ki + kd * kd;
+        };
+
+        Parameters tuned = control::refine(pool, initial, initial, cost, 0.5f, 1e-4f);
+        EXPECT_NEAR(2.0f, static_cast<float>(tuned.proportional), 1e-2f);
+        EXPECT_NEAR(3.0f, static_cast<float>(tuned.integral), 1e-2f);
+        EXPECT_NEAR(0.5f, static_cast<float>(tuned.differential), 1e-2f);
+    }
+
+    TEST(Refine, Zero) {
+        control::Pool pool(2);
+        Parameters initial{control::Gain<Pressure>(1.0f), control::Gain<Pressure>(), control::Gain<Pressure>(), Pressure(0.0f)};
+        Parameters scale{control::Gain<Pressure>(1.0f), control::Gain<Pressure>(2.0f), control::Gain<Pressure>(1e-2f), Pressure(0.0f)};
+        std::atomic<bool> negative{false};
+        auto cost = [&](const Parameters& p) {
+            float kp = static_cast<float>(p.proportional) - 2.0f;
+            float ki = static_cast<float>(p.integral) - 3.0f;
+            float kd = static_cast<float>(p.differential);
+            if (static_cast<float>(p.integral) < 0.0f || static_cast<float>(p.differential) < 0.0f) {
+                negative = true;
+            }
+            return kp * kp + ki * ki + kd * kd;
+        };
+
+        Parameters tuned = control::refine(pool, initial, scale, cost, 0.5f, 1e-4f);
+        EXPECT_NEAR(2.0f, static_cast<float>(tuned.proportional), 1e-2f);
+        EXPECT_NEAR(3.0f, static_cast<float>(tuned.integral), 1e-2f);
+        EXPECT_EQ(0.0f, static_cast<float>(tuned.differential));
+        EXPECT_FALSE(negative);
+    }
+
+    TEST(Refine, Fixed) {
+        control::Pool pool(2);
+        Parameters initial{control::Gain<Pressure>(1.0f), control::Gain<Pressure>(), control::Gain<Pressure>(), Pressure(0.0f)};
+        auto cost = [](const Parameters& p) {
+            float kp = static_cast<float>(p.proportional) - 2.0f;
+            float ki = static_cast<float>(p.integral) - 3.0f;
+            return kp * kp + ki * ki;
+        };
+
+        Parameters tuned = control::refine(pool, initial, initial, cost, 0.5f, 1e-4f);
+        EXPECT_NEAR(2.0f, static_cast<float>(tuned.proportional), 1e-2f);
+        EXPECT_EQ(0.0f, static_cast<float>(tuned.integral));
+    }
+
+    TEST(Refine, ClosedLoop) {
+        control::Pool pool(2);
+        auto cost = [](const Parameters& p) {
+            control::Plant<float> plant(
+                control::Valve<float>(Time(10ms), 2.0f)
+                , control::Compartment<float>(control::Mechanics<float>{10.0f, 5.0e-2f}, Pressure(0.0f))
+                , control::Leak<float>(0.0f)
+                );
+            control::PID<Pressure> pid(p.proportional, p.integral, p.differential, p.target);
+            std::vector<Pressure> response(500);
+            Pressure measured(0.0f);
+            for (Pressure& sample : response) {
+                sample      = plant(Pressure(pid(control::Process<Pressure>{measured, Time(1ms)})), Time(1ms)).pressure;
+                measured    = sample;
+            }
+            control::Metrics<float> metrics = control::evaluate<Pressure>(response, Pressure(0.0f), p.target, Time(1ms), 0.02f);
+            return metrics.iae + metrics.overshoot;
+        };
+
+        Parameters initial{control::Gain<Pressure>(0.5f), control::Gain<Pressure>(5.0e1f), control::Gain<Pressure>(3e-4f), Pressure(1.0f)};
+        Parameters tuned = control::refine(pool, initial, initial, cost);
+        EXPECT_LT(cost(tuned), cost(initial));
+    }
+} // namespace f32
+
+int
+main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,78 @@
+#include <control/control.hpp>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <ventilation/ventilation.hpp>
+
+using Pressure      = ventilation::Pressure<float>;
+using Process       = control::Process<Pressure>;
+using Parameters    = control::Parameters<Pressure>;
+using Mechanics     = control::Mechanics<float>;
+using Time          = control::Time<float>;
+
+const Pressure TARGET   = Pressure(1.0f);
+const Time DURATION     = Time(1e-3f);
+const Time BREATH       = Time(2e-1f);
+const Time LAG          = Time(1e-2f);
+const float VALVE       = 2.0f;
+
+control::Plant<float>
+patient() {
+    return control::Plant<float>(
+        control::Valve<float>(LAG, VALVE)
+        , control::Compartment<float>(Mechanics{10.0f, 5.0e-2f}, Pressure(0.0f))
+        , control::Leak<float>(0.0f)
+        );
+}
+
+float
+cost(const Parameters& parameters) {
+    control::Plant<float> plant = patient();
+    control::PID<Pressure> controller(parameters.proportional, parameters.integral, parameters.differential, TARGET);
+
+    std::vector<Pressure> response(static_cast<std::size_t>(BREATH / DURATION));
+    Process process{Pressure(0.0f), DURATION};
+    for (Pressure& sample : response) {
+        sample              = plant(Pressure(controller(process)), DURATION).pressure;
+        process.measurement = sample;
+    }
+
+    control::Metrics<float> metrics = control::evaluate<Pressure>(response, Pressure(0.0f), TARGET, DURATION, 0.02f);
+    return metrics.iae + metrics.overshoot;
+}
+
+int
+main(int, char**) {
+    control::Plant<float> experiment = patient();
+    auto ultimate = control::relay(
+        [&](const Pressure& command, const Time& duration) { return experiment(command, duration).pressure; }
+        , TARGET, TARGET, Pressure(0.5f), Pressure(0.05f), DURATION, 10000
+        );
+    if (!ultimate) {
+        std::cerr << "relay experiment did not settle" << std::endl;
+        return 1;
+    }
+
+    control::Pool pool;
+    Parameters estimate = control::ziegler_nichols(*ultimate, TARGET);
+    Parameters tuned    = control::refine(pool, estimate, estimate, cost);
+    std::cerr   << "kp=" << tuned.proportional
+                << " ki=" << tuned.integral
+                << " kd=" << tuned.differential
+                << std::endl;
+
+    control::PID<Pressure> controller(tuned.proportional, tuned.integral, tuned.differential, TARGET);
+    auto trajectory = control::Trajectory<Pressure>::square(Pressure(0.0f), TARGET, BREATH, DURATION, 0.5f);
+    control::Plant<float> plant = patient();
+
+    Process process{Pressure(0.0f), DURATION};
+    for (std::size_t i = 0; i < 2 * trajectory.size(); i++) {
+        const Pressure& target = trajectory();
+        process.measurement = plant(Pressure(controller(process, target)), DURATION).pressure;
+        std::cout   << target
+                    << ", "
+                    << process.measurement
+                    << std::endl;
+    }
+    return 0;
+}
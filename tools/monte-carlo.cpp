@@ -0,0 +1,133 @@
+#include <control/control.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+#include <ventilation/ventilation.hpp>
+
+using Pressure  = ventilation::Pressure<float>;
+using Process   = control::Process<Pressure>;
+using Gain      = control::Gain<Pressure>;
+using Mechanics = control::Mechanics<float>;
+using Summary   = control::Summary<float>;
+using Time      = control::Time<float>;
+
+const Time PERIOD           = Time(1e-3f);
+const Time HORIZON          = Time(1.0f);
+const Pressure PEEP         = Pressure(5.0f);
+const Pressure TARGET       = Pressure(20.0f);
+const float BAND            = 0.02f;
+const float VALVE           = 2.0f;
+
+struct Configuration {
+    float           proportional    = 0.5f;
+    float           integral        = 5.0e1f;
+    float           differential    = 3e-4f;
+    std::size_t     scenarios       = 10000;
+    std::uint64_t   seed            = 1;
+};
+
+struct alignas(control::CACHELINE) Worker {
+    std::mt19937_64         rng;
+    std::vector<Pressure>   trace;
+};
+
+Configuration
+parse(int argc, char** argv) {
+    Configuration configuration;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string_view flag(argv[i]);
+        const char* value = argv[i + 1];
+        if (flag == "--kp") {
+            configuration.proportional = std::strtof(value, nullptr);
+        } else if (flag == "--ki") {
+            configuration.integral = std::strtof(value, nullptr);
+        } else if (flag == "--kd") {
+            configuration.differential = std::strtof(value, nullptr);
+        } else if (flag == "--scenarios") {
+            configuration.scenarios = std::strtoull(value, nullptr, 10);
+        } else if (flag == "--seed") {
+            configuration.seed = std::strtoull(value, nullptr, 10);
+        }
+    }
+    return configuration;
+}
+
+control::Metrics<float>
+simulate(const Configuration& configuration, std::size_t scenario, Worker& worker) {
+    worker.rng.seed(configuration.seed ^ (scenario * 0x9e3779b97f4a7c15ull));
+    std::uniform_real_distribution<float> resistance(5.0f, 50.0f);
+    std::uniform_real_distribution<float> compliance(1.0e-2f, 1.0e-1f);
+    std::uniform_real_distribution<float> lag(2.0e-3f, 3.0e-2f);
+    std::uniform_real_distribution<float> leak(0.0f, 5.0e-2f);
+    std::uniform_real_distribution<float> sigma(0.0f, 0.5f);
+    std::normal_distribution<float>       noise(0.0f, 1.0f);
+
+    const float airway      = resistance(worker.rng);
+    const float elasticity  = compliance(worker.rng);
+    const float response    = lag(worker.rng);
+    const float leakage     = leak(worker.rng);
+    const float deviation   = sigma(worker.rng);
+
+    control::Plant<float> plant(
+        control::Valve<float>(Time(response), VALVE)
+        , control::Compartment<float>(Mechanics{airway, elasticity}, PEEP)
+        , control::Leak<float>(leakage)
+        );
+    control::PID<Pressure> controller(
+        Gain(configuration.proportional)
+        , Gain(configuration.integral)
+        , Gain(configuration.differential)
+        , TARGET
+        );
+
+    Pressure measured = PEEP;
+    for (Pressure& sample : worker.trace) {
+        Process process{measured + Pressure(deviation * noise(worker.rng)), PERIOD};
+        sample      = plant(Pressure(controller(process)), PERIOD).pressure;
+        measured    = sample;
+    }
+
+    return control::evaluate<Pressure>(worker.trace, PEEP, TARGET, PERIOD, BAND);
+}
+
+int
+main(int argc, char** argv) {
+    Configuration configuration = parse(argc, argv);
+    control::Pool pool;
+
+    std::size_t steps = static_cast<std::size_t>(HORIZON / PERIOD);
+    std::vector<Worker> workers(pool.size());
+    for (Worker& worker : workers) {
+        worker.trace.resize(steps);
+    }
+
+    std::vector<control::Metrics<float>> results(configuration.scenarios);
+
+    auto start = std::chrono::steady_clock::now();
+    pool(configuration.scenarios, [&](std::size_t scenario, std::size_t worker) {
+        results[scenario] = simulate(configuration, scenario, workers[worker]);
+    });
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+
+    Summary summary;
+    for (const control::Metrics<float>& result : results) {
+        summary.add(result);
+    }
+
+    control::Metrics<float> mean    = summary.mean();
+    control::Metrics<float> worst   = summary.worst();
+    std::cout   << "scenarios,"         << summary.count()          << std::endl
+                << "threads,"           << pool.size()              << std::endl
+                << "seconds,"           << elapsed.count()          << std::endl
+                << "mean_overshoot,"    << mean.overshoot           << std::endl
+                << "worst_overshoot,"   << worst.overshoot          << std::endl
+                << "mean_settling_s,"   << mean.settling.count()    << std::endl
+                << "worst_settling_s,"  << worst.settling.count()   << std::endl
+                << "mean_iae,"          << mean.iae                 << std::endl
+                << "worst_iae,"         << worst.iae                << std::endl;
+    return 0;
+}
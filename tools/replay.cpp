@@ -0,0 +1,67 @@
+#include <control/control.hpp>
+#include <control/control-replay.hpp>
+#include <control/control-trace.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <ventilation/ventilation.hpp>
+
+using Pressure  = ventilation::Pressure<float>;
+using Gain      = control::Gain<Pressure>;
+using PID       = control::PID<Pressure>;
+
+int
+main(int argc, char** argv) {
+    if (argc < 4) {
+        std::cerr << "usage: " << argv[0] << " <trace> <channel> <kp:ki:kd>..." << std::endl;
+        return 2;
+    }
+
+    control::trace::Reader<float> reader(argv[1]);
+    if (!reader) {
+        std::cerr << argv[1] << ": not an f32 control trace" << std::endl;
+        return 1;
+    }
+
+    std::uint32_t channel   = static_cast<std::uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    Pressure target         = reader.records().empty() ? Pressure(0.0f) : Pressure(reader.records()[0].target);
+
+    std::vector<PID> candidates;
+    for (int i = 3; i < argc; i++) {
+        float kp = 0.0f;
+        float ki = 0.0f;
+        float kd = 0.0f;
+        if (std::sscanf(argv[i], "%f:%f:%f", &kp, &ki, &kd) != 3) {
+            std::cerr << argv[i] << ": expected kp:ki:kd" << std::endl;
+            return 2;
+        }
+        candidates.emplace_back(Gain(kp), Gain(ki), Gain(kd), target);
+    }
+
+    control::Replay<Pressure, PID> replay(std::move(candidates), channel);
+    control::Pool pool;
+    auto start = std::chrono::steady_clock::now();
+    replay(pool, reader.records());
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+
+    std::printf("candidate,configuration,samples,diverged,worst,first_index,first_timestamp_ns,recorded,replayed\n");
+    for (std::size_t i = 0; i < replay.size(); i++) {
+        const control::Report<float>& report = replay.report(i);
+        std::printf("%zu,%s,%zu,%zu,%.9g", i, argv[i + 3], report.samples, report.diverged, static_cast<double>(report.worst));
+        if (report.first) {
+            std::printf(",%zu,%llu,%.9g,%.9g\n"
+                , report.first->index
+                , static_cast<unsigned long long>(report.first->timestamp)
+                , static_cast<double>(report.first->recorded)
+                , static_cast<double>(report.first->replayed)
+                );
+        } else {
+            std::printf(",,,,\n");
+        }
+    }
+    std::cerr << reader.records().size() << " records in " << elapsed.count() << " s" << std::endl;
+    return 0;
+}
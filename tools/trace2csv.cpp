@@ -0,0 +1,46 @@
+#include <control/control-trace.hpp>
+#include <cinttypes>
+#include <cstdio>
+#include <iostream>
+
+template <typename Precision>
+bool
+convert(const char* path, std::FILE* out) {
+    control::trace::Reader<Precision> reader(path);
+    if (!reader) {
+        return false;
+    }
+
+    std::fputs("timestamp_ns,channel,flags,duration_s,measurement,target,proportional,integral,differential,output\n", out);
+    for (const control::trace::Record<Precision>& record : reader.records()) {
+        std::fprintf(out, "%" PRIu64 ",%" PRIu32 ",%" PRIu32 ",%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g\n"
+            , record.timestamp
+            , record.channel
+            , record.flags
+            , static_cast<double>(record.duration)
+            , static_cast<double>(record.measurement)
+            , static_cast<double>(record.target)
+            , static_cast<double>(record.proportional)
+            , static_cast<double>(record.integral)
+            , static_cast<double>(record.differential)
+            , static_cast<double>(record.output)
+            );
+    }
+    return true;
+}
+
+int
+main(int argc, char** argv) {
+    if (argc != 2) {
+        std::cerr << "usage: " << argv[0] << " <trace>" << std::endl;
+        return 2;
+    }
+
+    static char buffer[1 << 16];
+    std::setvbuf(stdout, buffer, _IOFBF, sizeof(buffer));
+    if (!convert<float>(argv[1], stdout) && !convert<double>(argv[1], stdout)) {
+        std::cerr << argv[1] << ": not a control trace" << std::endl;
+        return 1;
+    }
+    return 0;
+}